@@ -27,6 +27,7 @@
 #include "../../00_LIB/BIT_MATH.h"
 #include "RegMap.h"
 #include "../01_PORT/PORT_CONFIG.h"
+#include "../02_Interrupt/Critical.h"
 /******************************************************************************/
 
 /******************************************************************************/
@@ -246,4 +247,49 @@ DIO_enumError_t DIO_enumGetState(DIO_enmPortOPTS Copy_enmPortNum,DIO_enumPins_t
 }
 
 
-/******************************************************************************/
\ No newline at end of file
+DIO_enumError_t DIO_enumSetMasked(DIO_enmPortOPTS Copy_enmPortNum,uint8_t Copy_u8Mask,uint8_t Copy_u8Value)
+{
+	/* Validation */
+	DIO_enumError_t Ret_enmErrorStatus = DIO_enmOk;												  /*The Error State code*/
+	if(Copy_enmPortNum > LAST_PORT || Copy_enmPortNum < DIO_enmPortA)				  		  /*Check if the Port Entered in the range or not*/
+	{
+		Ret_enmErrorStatus = DIO_enmPortInvalid;												  /*Return will be Not valid port*/
+	}
+	else if((cpstDIOPortReg[Copy_enmPortNum]->u8DDR & Copy_u8Mask) != Copy_u8Mask)			  /*Check if any masked pin is input*/
+	{
+		Ret_enmErrorStatus = DIO_enmPinIsInputNotOutput;                                          /*return will be the pin is input can't execute*/
+	}
+	else
+	{
+		/*implementation*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();																 /*no ISR can touch the port in the middle*/
+		cpstDIOPortReg[Copy_enmPortNum]->u8PORT = (cpstDIOPortReg[Copy_enmPortNum]->u8PORT & ~Copy_u8Mask)
+							  | (Copy_u8Value & Copy_u8Mask);					 /*all masked pins change together*/
+		CRITICAL_vExit(LOC_u8SREG);																		 /*restore the interrupt state*/
+	}
+	return Ret_enmErrorStatus;																	/*return the function execution state*/
+}
+
+
+DIO_enumError_t DIO_enumReadPort(DIO_enmPortOPTS Copy_enmPortNum,uint8_t* Add_Pu8PortValue)
+{
+	/* Validation */
+	DIO_enumError_t Ret_enmErrorStatus = DIO_enmOk;												  /*The Error State code*/
+	if(Copy_enmPortNum > LAST_PORT || Copy_enmPortNum < DIO_enmPortA)				  		  /*Check if the Port Entered in the range or not*/
+	{
+		Ret_enmErrorStatus = DIO_enmPortInvalid;												  /*Return will be Not valid port*/
+	}
+	else if(Add_Pu8PortValue == NULL)															/*Check if Add_Pu8PortValue equal NULL*/
+	{
+		Ret_enmErrorStatus = DIO_NullPtrPassed;
+	}
+	else
+	{
+		/*Implementation*/
+		*Add_Pu8PortValue = GET_REG(cpstDIOPortReg[Copy_enmPortNum]->u8PIN);					   /*one read samples all pins at the same time*/
+	}
+	return Ret_enmErrorStatus;
+}
+
+
+/******************************************************************************/
@@ -45,6 +45,30 @@ extern "C"
 /* PUBLIC DEFINES */
 /******************************************************************************/
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief address of PINA register , each port has (PINx , DDRx , PORTx) registers
+ *		  and the ports are placed downwards 3 bytes apart (A , B , C , D).
+*/
+/*----------------------------------------------------------------------------*/
+#define		DIO_PORTS_BASE_ADD		0x39
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief number of bytes between the registers of two neighbour ports.
+*/
+/*----------------------------------------------------------------------------*/
+#define		DIO_PORTS_STRIDE		3
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief port names used with DIO_PIN descriptor.
+*/
+/*----------------------------------------------------------------------------*/
+#define		DIO_PORT_PortA			0
+#define		DIO_PORT_PortB			1
+#define		DIO_PORT_PortC			2
+#define		DIO_PORT_PortD			3
 
 /******************************************************************************/
 
@@ -52,6 +76,28 @@ extern "C"
 /* PUBLIC MACROS */
 /******************************************************************************/
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief access the PINx , DDRx and PORTx registers of a port number , if the
+ *		  port is a constant the address is a constant too.
+*/
+/*----------------------------------------------------------------------------*/
+#define		DIO_PIN_REG(_PORT)		(*((volatile uint8_t *)(DIO_PORTS_BASE_ADD     - DIO_PORTS_STRIDE * (_PORT))))
+#define		DIO_DDR_REG(_PORT)		(*((volatile uint8_t *)(DIO_PORTS_BASE_ADD + 1 - DIO_PORTS_STRIDE * (_PORT))))
+#define		DIO_PORT_REG(_PORT)		(*((volatile uint8_t *)(DIO_PORTS_BASE_ADD + 2 - DIO_PORTS_STRIDE * (_PORT))))
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief pin descriptor , it expands to the (port , pin) arguments of the fast
+ *		  pin API so a pin can be named once and used every where.
+ *
+ *		  EX. #define LED_PIN		DIO_PIN(PortB,3)
+ *		      DIO_vSetPinFast(LED_PIN);		compiles to : sbi 0x18,3
+ *
+ * @note  the pin is the bit number in the port (0 .. 7) like the data sheet (PB3).
+*/
+/*----------------------------------------------------------------------------*/
+#define		DIO_PIN(_PORT,_PIN)		(DIO_PORT_##_PORT) , (_PIN)
 /******************************************************************************/
 
 /******************************************************************************/
@@ -330,6 +376,127 @@ DIO_enumError_t DIO_enumGetState(DIO_enmPortOPTS Copy_enmPortNum,DIO_enumPins_t
 
 
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief							 used to change any group of output pins in the same port together
+ *									 in one read-modify-write , the pins change at the same time.
+ * 
+ * @param[in] Copy_enmPortNum        this attribute used to determine the port which you want to use
+ *									 (EX. DIO_enmPortA)  , allowed only DIO_enmPortA ,DIO_enmPortB
+ *									 DIO_enmPortC , DIO_enmPortD.
+ *
+ * @param[in] Copy_u8Mask			 the pins which will change (bit for each pin).
+ * 									  
+ * @param[in] Copy_u8Value			 the new state of the masked pins , the other bits are ignored.
+ *
+ * @return enum contain Error State
+ * 
+ * @note							 all masked pins must be output , it is done with interrupts masked
+ *									 so an ISR using the same port can not be corrupted.
+/*----------------------------------------------------------------------------*/
+DIO_enumError_t DIO_enumSetMasked(DIO_enmPortOPTS Copy_enmPortNum,uint8_t Copy_u8Mask,uint8_t Copy_u8Value);
+
+
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief							 used to read all pins of a port in one sample.
+ * 
+ * @param[in] Copy_enmPortNum        this attribute used to determine the port which you want to use
+ *									 (EX. DIO_enmPortA)  , allowed only DIO_enmPortA ,DIO_enmPortB
+ *									 DIO_enmPortC , DIO_enmPortD.
+ * 									  
+ * @param[in/out] Add_Pu8PortValue   this attribute used for update the port status (bit for each pin).
+ *
+ * @return enum contain Error State
+/*----------------------------------------------------------------------------*/
+DIO_enumError_t DIO_enumReadPort(DIO_enmPortOPTS Copy_enmPortNum,uint8_t* Add_Pu8PortValue);
+
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC INLINE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief							 the fast pin API , it does no checks so the port , the pin and the
+ *									 direction must be right. when the port and the pin are constants each
+ *									 function compiles to one SBI , CBI or SBIC/SBIS instruction.
+ *									 use the checked API when the port or the pin come at run time.
+ *
+ * @param[in] Copy_u8Port			 the port number (DIO_enmPortA .. DIO_enmPortD) or DIO_PIN descriptor.
+ *
+ * @param[in] Copy_u8Pin			 the pin number in the port (0 .. 7).
+*/
+/*----------------------------------------------------------------------------*/
+static inline void DIO_vSetPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin) __attribute__((always_inline));
+static inline void DIO_vSetPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin)
+{
+	DIO_PORT_REG(Copy_u8Port) |= (uint8_t)(1 << Copy_u8Pin);
+}
+
+static inline void DIO_vClrPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin) __attribute__((always_inline));
+static inline void DIO_vClrPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin)
+{
+	DIO_PORT_REG(Copy_u8Port) &= (uint8_t)~(1 << Copy_u8Pin);
+}
+
+static inline void DIO_vWritePinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin, uint8_t Copy_u8State) __attribute__((always_inline));
+static inline void DIO_vWritePinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin, uint8_t Copy_u8State)
+{
+	if(Copy_u8State != DIO_enumLogicLow)
+	{
+		DIO_vSetPinFast(Copy_u8Port,Copy_u8Pin);
+	}
+	else
+	{
+		DIO_vClrPinFast(Copy_u8Port,Copy_u8Pin);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @note							 ATmega32 can not toggle by writing PINx so the toggle is a
+ *									 read-modify-write (IN , EOR , OUT) , it is not atomic.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void DIO_vTogPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin) __attribute__((always_inline));
+static inline void DIO_vTogPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin)
+{
+	DIO_PORT_REG(Copy_u8Port) ^= (uint8_t)(1 << Copy_u8Pin);
+}
+
+static inline uint8_t DIO_u8GetPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin) __attribute__((always_inline));
+static inline uint8_t DIO_u8GetPinFast(uint8_t Copy_u8Port, uint8_t Copy_u8Pin)
+{
+	return (DIO_PIN_REG(Copy_u8Port) & (uint8_t)(1 << Copy_u8Pin)) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief							 the fast versions of DIO_enumSetMasked and DIO_enumReadPort.
+ *
+ * @note							 DIO_vSetMaskedFast does not mask interrupts , use it in ISRs or
+ *									 when no ISR writes the same port.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void DIO_vSetMaskedFast(uint8_t Copy_u8Port, uint8_t Copy_u8Mask, uint8_t Copy_u8Value) __attribute__((always_inline));
+static inline void DIO_vSetMaskedFast(uint8_t Copy_u8Port, uint8_t Copy_u8Mask, uint8_t Copy_u8Value)
+{
+	DIO_PORT_REG(Copy_u8Port) = (DIO_PORT_REG(Copy_u8Port) & (uint8_t)~Copy_u8Mask) | (Copy_u8Value & Copy_u8Mask);
+}
+
+static inline uint8_t DIO_u8ReadPortFast(uint8_t Copy_u8Port) __attribute__((always_inline));
+static inline uint8_t DIO_u8ReadPortFast(uint8_t Copy_u8Port)
+{
+	return DIO_PIN_REG(Copy_u8Port);
+}
+
+
+
 
 
 
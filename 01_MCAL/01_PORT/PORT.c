@@ -25,6 +25,8 @@
 #include "../../00_LIB/BIT_MATH.h"
 #include "../../00_LIB/Platform_Types.h"
 #include "PORT_CONFIG.h"
+#include "../02_Interrupt/Critical.h"
+#include "../../05_Configs/PinsCfg.h"
 
 /******************************************************************************/
 
@@ -54,6 +56,106 @@
 /* PRIVATE MACROS */
 /******************************************************************************/
 
+/**
+*@brief used to reduce the pin configuration options to the DDR bit and the PORT bit.
+*/
+#define PIN_IS_OUTPUT(_CFG)		((_CFG) == OUTPUT_HIGH || (_CFG) == OUTPUT_LOW)
+#define PIN_IS_HIGH(_CFG)		((_CFG) == OUTPUT_HIGH || (_CFG) == INPUT_INERNAL_PULL_UP)
+
+/**
+*@brief used to reduce the PORTx_PINy_CFG macros of the port _P (A,B,C or D) to one byte.
+*/
+#define PORT_IMAGE(_P,_IS)		( (_IS(PORT##_P##_PIN1_CFG) << 0) | \
+							(_IS(PORT##_P##_PIN2_CFG) << 1) | \
+							(_IS(PORT##_P##_PIN3_CFG) << 2) | \
+							(_IS(PORT##_P##_PIN4_CFG) << 3) | \
+							(_IS(PORT##_P##_PIN5_CFG) << 4) | \
+							(_IS(PORT##_P##_PIN6_CFG) << 5) | \
+							(_IS(PORT##_P##_PIN7_CFG) << 6) | \
+							(_IS(PORT##_P##_PIN8_CFG) << 7) )
+
+#define DDR_IMAGE(_P)			PORT_IMAGE(_P,PIN_IS_OUTPUT)
+#define PORT_REG_IMAGE(_P)		PORT_IMAGE(_P,PIN_IS_HIGH)
+
+/**
+*@brief used to count the set bits in a byte at compile time.
+*/
+#define BITS_COUNT(_U8)			( (((_U8) >> 0) & 1) + \
+							(((_U8) >> 1) & 1) + \
+							(((_U8) >> 2) & 1) + \
+							(((_U8) >> 3) & 1) + \
+							(((_U8) >> 4) & 1) + \
+							(((_U8) >> 5) & 1) + \
+							(((_U8) >> 6) & 1) + \
+							(((_U8) >> 7) & 1) )
+
+/**
+*@brief the pins of each module in the port _P (A,B,C or D) , they come from
+*	05_Configs/PinsCfg.h.
+*/
+#define LED_MASK(_P)			CFG_LED_PINS(PORT_NUM_PORT##_P)
+#define SEG7_MASK(_P)			CFG_SEG7_PINS(PORT_NUM_PORT##_P)
+#define LCD_MASK(_P)			CFG_LCD_PINS(PORT_NUM_PORT##_P)
+#define SWPWM_MASK(_P)			CFG_SWPWM_PINS(PORT_NUM_PORT##_P)
+#define SWITCH_MASK(_P)			CFG_SWITCH_PINS(PORT_NUM_PORT##_P)
+#define KEYPAD_ROWS_MASK(_P)		CFG_KEYPAD_ROWS_PINS(PORT_NUM_PORT##_P)
+#define KEYPAD_COLS_MASK(_P)		CFG_KEYPAD_COLS_PINS(PORT_NUM_PORT##_P)
+#define RTC_MASK(_P)			CFG_RTC_PINS(PORT_NUM_PORT##_P)
+
+/**
+*@brief the pins which HAL modules use in the port _P as outputs and as inputs.
+*/
+#define OUTPUT_PINS(_P)			(LED_MASK(_P) | SEG7_MASK(_P) | LCD_MASK(_P) \
+							| KEYPAD_COLS_MASK(_P) | SWPWM_MASK(_P))
+#define INPUT_PINS(_P)			(SWITCH_MASK(_P) | KEYPAD_ROWS_MASK(_P))
+
+/**
+*@brief a pin is claimed twice if the claims have more bits than their union.
+*/
+#define PINS_CONFLICT(_P)		((BITS_COUNT(LED_MASK(_P)) + BITS_COUNT(SEG7_MASK(_P)) \
+							+ BITS_COUNT(LCD_MASK(_P)) + BITS_COUNT(KEYPAD_COLS_MASK(_P)) \
+							+ BITS_COUNT(SWPWM_MASK(_P)) + BITS_COUNT(RTC_MASK(_P)) \
+							+ BITS_COUNT(SWITCH_MASK(_P)) + BITS_COUNT(KEYPAD_ROWS_MASK(_P))) \
+							!= BITS_COUNT(OUTPUT_PINS(_P) | INPUT_PINS(_P) | RTC_MASK(_P)))
+
+/**
+*@brief the pin direction in the pre-compiled image is against the module which uses it.
+*/
+#define PINS_WRONG_DIR(_P)		(((OUTPUT_PINS(_P) & ~DDR_IMAGE(_P)) | (INPUT_PINS(_P) & DDR_IMAGE(_P))) & 0xFF)
+
+/******************************************************************************/
+
+#if PINS_CONFLICT(A)
+#error PORT A : a pin is used by two HAL modules , check the pins of the used modules
+#endif
+#if PINS_CONFLICT(B)
+#error PORT B : a pin is used by two HAL modules , check the pins of the used modules
+#endif
+#if PINS_CONFLICT(C)
+#error PORT C : a pin is used by two HAL modules , check the pins of the used modules
+#endif
+#if NUMBER_OF_PORTS == 4 && PINS_CONFLICT(D)
+#error PORT D : a pin is used by two HAL modules , check the pins of the used modules
+#endif
+
+#if COMPILATION_MODE == PRE_COMPILATION_MODE
+#if PINS_WRONG_DIR(A)
+#error PORT A : PORTA_PINy_CFG direction is against the HAL module which uses the pin
+#endif
+#if PINS_WRONG_DIR(B)
+#error PORT B : PORTB_PINy_CFG direction is against the HAL module which uses the pin
+#endif
+#if PINS_WRONG_DIR(C)
+#error PORT C : PORTC_PINy_CFG direction is against the HAL module which uses the pin
+#endif
+#if NUMBER_OF_PORTS == 4
+#if PINS_WRONG_DIR(D)
+#error PORT D : PORTD_PINy_CFG direction is against the HAL module which uses the pin
+#endif
+#endif
+#elif COMPILATION_MODE != POST_COMPILATION_MODE
+#error COMPILATION_MODE Is configure in wrong way.
+#endif
  
 /******************************************************************************/
  
@@ -104,6 +206,13 @@ static DIOPortsReg_t* const cpstDIOPortRegs[NUMBER_OF_PORTS] = {PORTA , PORTB ,
 /* PRIVATE VARIABLE DEFINITIONS */
 /******************************************************************************/
 
+#if COMPILATION_MODE == POST_COMPILATION_MODE
+/**
+*@brief the pins configuration table which defined in PORT_CONFIG.c
+*/
+extern uint8_t stPinsConfigurations[NUMBER_OF_PINS_IN_EACH_PORT * NUMBER_OF_PORTS];
+#endif
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -145,6 +254,17 @@ static DIOPortsReg_t* const cpstDIOPortRegs[NUMBER_OF_PORTS] = {PORTA , PORTB ,
 static PORT_enmError_t enmSetPinConfig(const PORT_enmPortOPTS_t Copy_enmPortNum,const PORT_enumPins_t Copy_enmPinNum
 																	,const PORT_enmConfig_t Copy_enmConfig);
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief							 this function used to check one pin configuration without
+ *									 touching the registers.
+ *
+ * @param[in] ADD_cpstPortConf		the pin configuration which you want to check.
+ *
+ * @return enum contain Error State
+/*----------------------------------------------------------------------------*/
+static PORT_enmError_t enmCheckPinConfig(const PORT_stPortCfg_t * const ADD_cpstPortConf);
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -152,6 +272,31 @@ static PORT_enmError_t enmSetPinConfig(const PORT_enmPortOPTS_t Copy_enmPortNum,
 /******************************************************************************/
 /******************************************************************************/
 
+static PORT_enmError_t enmCheckPinConfig(const PORT_stPortCfg_t * const ADD_cpstPortConf)
+{
+	/* Validation */
+	PORT_enmError_t Ret_enmErrorStatus = PORT_enmOk;						/*The Error State code*/
+	if(ADD_cpstPortConf->enmPort > LAST_PORT || ADD_cpstPortConf->enmPort < PORT_enmPortA)	/*Check if the Port Entered in the range or not*/
+	{
+		Ret_enmErrorStatus = PORT_enmPortInvalid;							/*Return will be Not valid port*/
+	}
+	else if(ADD_cpstPortConf->enmPin > PORT_enumPin8						/*Check if the pin Entered in the range or not*/
+			|| ADD_cpstPortConf->enmPin < PORT_enumPin1 )
+	{
+		Ret_enmErrorStatus = PORT_enmPinNumOutOfRange;						/*Return will be Pin out of the allowed range*/
+	}
+	else if(ADD_cpstPortConf->enmPinConf > PORT_enumInputExternalPullDown	/*check if pin configuration right*/
+		   || ADD_cpstPortConf->enmPinConf < PORT_enmOutputHigh)
+	{
+		Ret_enmErrorStatus = PORT_enmInValidPinConf;						/*Return Invalid Configuration*/
+	}
+	else
+	{
+		/*No thing*/
+	}
+	return Ret_enmErrorStatus;												/*return the function execution state*/
+}
+
 static PORT_enmError_t enmSetPinConfig(const PORT_enmPortOPTS_t Copy_enmPortNum,const PORT_enumPins_t Copy_enmPinNum
 																				,const PORT_enmConfig_t Copy_enmConfig)
 {
@@ -225,4 +370,111 @@ PORT_enmError_t PORT_enmSetCfg(const PORT_stPortCfg_t * const ADD_cpstPortConf)
 									,ADD_cpstPortConf->enmPin, ADD_cpstPortConf->enmPinConf);
 	return Ret_enmErrorStatus;													/*return the error status*/
 }
-/******************************************************************************/
\ No newline at end of file
+/******************************************************************************/
+
+PORT_enmError_t PORT_enmSetCfgBatch(const PORT_stPortCfg_t * const ADD_cpstPortConf, const uint8_t Copy_u8Count)
+{
+	PORT_enmError_t Ret_enmErrorStatus = PORT_enmOk;							/*the error status of the whole table*/
+	uint8_t LOC_au8Mask[NUMBER_OF_PORTS]	= {0};								/*the pins touched in each port*/
+	uint8_t LOC_au8DDR[NUMBER_OF_PORTS]	= {0};								/*the new direction of the touched pins*/
+	uint8_t LOC_au8PORT[NUMBER_OF_PORTS]	= {0};								/*the new level/pull-up of the touched pins*/
+	uint8_t LOC_u8Entry = 0;													/*index of the entry under processing*/
+	if(ADD_cpstPortConf == NULL)												/*check the table address*/
+	{
+		Ret_enmErrorStatus = PORT_enmNullPtrPassed;								/*return null pointer passed*/
+	}
+	else
+	{
+		/*check the whole table first , a bad entry leaves all registers untouched*/
+		for(LOC_u8Entry = 0 ; LOC_u8Entry < Copy_u8Count && Ret_enmErrorStatus == PORT_enmOk ; LOC_u8Entry++)
+		{
+			Ret_enmErrorStatus = enmCheckPinConfig(&ADD_cpstPortConf[LOC_u8Entry]);
+		}
+	}
+
+	if(Ret_enmErrorStatus == PORT_enmOk)
+	{
+		/*fold the table into one DDR image and one PORT image for each port*/
+		for(LOC_u8Entry = 0 ; LOC_u8Entry < Copy_u8Count ; LOC_u8Entry++)
+		{
+			uint8_t LOC_u8Port = ADD_cpstPortConf[LOC_u8Entry].enmPort;
+			uint8_t LOC_u8Pin  = ADD_cpstPortConf[LOC_u8Entry].enmPin;
+			SET_BIT(LOC_au8Mask[LOC_u8Port],LOC_u8Pin);
+			switch(ADD_cpstPortConf[LOC_u8Entry].enmPinConf)
+			{
+				case PORT_enmOutputHigh:
+				SET_BIT(LOC_au8DDR[LOC_u8Port],LOC_u8Pin);						/*output*/
+				SET_BIT(LOC_au8PORT[LOC_u8Port],LOC_u8Pin);					/*high*/
+				break;
+				case PORT_enmOutputLOW:
+				SET_BIT(LOC_au8DDR[LOC_u8Port],LOC_u8Pin);						/*output*/
+				CLR_BIT(LOC_au8PORT[LOC_u8Port],LOC_u8Pin);					/*low*/
+				break;
+				case PORT_enumInputInternalPullUp:
+				CLR_BIT(LOC_au8DDR[LOC_u8Port],LOC_u8Pin);						/*input*/
+				SET_BIT(LOC_au8PORT[LOC_u8Port],LOC_u8Pin);					/*pull-up activated*/
+				break;
+				case PORT_enumInputExternalPullDown:
+				CLR_BIT(LOC_au8DDR[LOC_u8Port],LOC_u8Pin);						/*input*/
+				CLR_BIT(LOC_au8PORT[LOC_u8Port],LOC_u8Pin);					/*pull-up disabled*/
+				break;
+				default:														/*otherwise nothing yo do*/
+				break;
+			}
+		}
+
+		/*apply each touched port , the order keeps every pin out of wrong states :
+		* 1- the pins which become inputs stop driving first.
+		* 2- the new levels/pull-ups are written while the new outputs still inputs.
+		* 3- the new outputs start driving with the right level.*/
+		for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < NUMBER_OF_PORTS ; LOC_u8Port++)
+		{
+			if(LOC_au8Mask[LOC_u8Port] != 0)
+			{
+				uint8_t LOC_u8SREG = CRITICAL_u8Enter();												/*no ISR can touch the port in the middle*/
+				cpstDIOPortRegs[LOC_u8Port]->u8DDR &= ~(LOC_au8Mask[LOC_u8Port] & ~LOC_au8DDR[LOC_u8Port]);
+				cpstDIOPortRegs[LOC_u8Port]->u8PORT = (cpstDIOPortRegs[LOC_u8Port]->u8PORT & ~LOC_au8Mask[LOC_u8Port])
+													| LOC_au8PORT[LOC_u8Port];
+				cpstDIOPortRegs[LOC_u8Port]->u8DDR |= LOC_au8DDR[LOC_u8Port];
+				CRITICAL_vExit(LOC_u8SREG);														/*restore the interrupt state*/
+			}
+		}
+	}
+	return Ret_enmErrorStatus;													/*return the error status*/
+}
+/******************************************************************************/
+
+void PORT_vInit(void)
+{
+#if COMPILATION_MODE == PRE_COMPILATION_MODE
+	/*the images are constants , so each write is a single instruction.
+	* PORT is written before DDR : the outputs get their level while they are still inputs.*/
+	cpstDIOPortRegs[PORT_enmPortA]->u8PORT = PORT_REG_IMAGE(A);
+	cpstDIOPortRegs[PORT_enmPortB]->u8PORT = PORT_REG_IMAGE(B);
+	cpstDIOPortRegs[PORT_enmPortC]->u8PORT = PORT_REG_IMAGE(C);
+	#if NUMBER_OF_PORTS == 4
+	cpstDIOPortRegs[PORT_enmPortD]->u8PORT = PORT_REG_IMAGE(D);
+	#endif
+	cpstDIOPortRegs[PORT_enmPortA]->u8DDR  = DDR_IMAGE(A);
+	cpstDIOPortRegs[PORT_enmPortB]->u8DDR  = DDR_IMAGE(B);
+	cpstDIOPortRegs[PORT_enmPortC]->u8DDR  = DDR_IMAGE(C);
+	#if NUMBER_OF_PORTS == 4
+	cpstDIOPortRegs[PORT_enmPortD]->u8DDR  = DDR_IMAGE(D);
+	#endif
+#elif COMPILATION_MODE == POST_COMPILATION_MODE
+	for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < NUMBER_OF_PORTS ; LOC_u8Port++)
+	{
+		uint8_t LOC_u8DDR  = 0;												/*the direction image of the port*/
+		uint8_t LOC_u8PORT = 0;												/*the level/pull-up image of the port*/
+		for(uint8_t LOC_u8Pin = 0 ; LOC_u8Pin < NUMBER_OF_PINS_IN_EACH_PORT ; LOC_u8Pin++)
+		{
+			uint8_t LOC_u8Cfg = stPinsConfigurations[LOC_u8Port * NUMBER_OF_PINS_IN_EACH_PORT + LOC_u8Pin];
+			LOC_u8DDR  |= (PIN_IS_OUTPUT(LOC_u8Cfg) << LOC_u8Pin);
+			LOC_u8PORT |= (PIN_IS_HIGH(LOC_u8Cfg) << LOC_u8Pin);
+		}
+		cpstDIOPortRegs[LOC_u8Port]->u8PORT = LOC_u8PORT;					/*the outputs get their level while they are still inputs*/
+		cpstDIOPortRegs[LOC_u8Port]->u8DDR  = LOC_u8DDR;
+	}
+#endif
+}
+/******************************************************************************/
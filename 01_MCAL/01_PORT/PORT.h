@@ -44,6 +44,25 @@ extern "C"
 /* PUBLIC DEFINES */
 /******************************************************************************/
 
+/**
+*@brief the ports and the pins as numbers for the pre-processor , each one is
+*		equal to its PORT_enmPortX or PORT_enumPinY. the configuration tables
+*		of the HAL modules are written with them so their pins are checked
+*		at compile time (see 05_Configs/PinsCfg.h).
+*/
+#define PORT_NUM_PORTA			0
+#define PORT_NUM_PORTB			1
+#define PORT_NUM_PORTC			2
+#define PORT_NUM_PORTD			3
+
+#define PORT_NUM_PIN1			0
+#define PORT_NUM_PIN2			1
+#define PORT_NUM_PIN3			2
+#define PORT_NUM_PIN4			3
+#define PORT_NUM_PIN5			4
+#define PORT_NUM_PIN6			5
+#define PORT_NUM_PIN7			6
+#define PORT_NUM_PIN8			7
 
 /******************************************************************************/
 
@@ -51,6 +70,12 @@ extern "C"
 /* PUBLIC MACROS */
 /******************************************************************************/
 
+/**
+*@brief the bit of a pin in the mask of the port _P , 0 if the pin is in another port.
+*		EX:- #define LED_PINS(_P)	PORT_PIN_BIT(FIRST_LED_PORT,FIRST_LED_PIN,_P)
+*/
+#define PORT_PIN_BIT(_PORT,_PIN,_P)		(((_PORT) == (_P)) ? (1 << (_PIN)) : 0)
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -335,6 +360,32 @@ typedef struct
 */
 PORT_enmError_t PORT_enmSetCfg(const PORT_stPortCfg_t * const ADD_cpstPortConf);
 
+/*
+* @brief		this function used to Set the configuration of a whole table of pins.
+*				all entries are checked first then the table is folded into one DDR
+*				value and one PORT value for each port , so each port is written at
+*				most three times whatever the number of its pins.
+*
+* @param[in]	ADD_cpstPortConf	the address of the first configuration in the table.
+*
+* @param[in]	Copy_u8Count		the number of configurations in the table.
+*
+* @note			if any entry is wrong no register is changed and its error is returned.
+*				if a pin is repeated in the table the last entry wins.
+*/
+PORT_enmError_t PORT_enmSetCfgBatch(const PORT_stPortCfg_t * const ADD_cpstPortConf, const uint8_t Copy_u8Count);
+
+/*
+* @brief		this function used to apply the pins configuration of PORT_CONFIG.h / PORT_CONFIG.c
+*				to all ports.
+*				in PRE_COMPILATION_MODE the PORTx_PINy_CFG macros are reduced at compile time to
+*				constant DDR and PORT bytes , so the function is only one write for each register.
+*				in POST_COMPILATION_MODE the stPinsConfigurations table is folded at run time.
+*
+* @note			call it once at the start before any other driver init.
+*/
+void PORT_vInit(void);
+
 /******************************************************************************/
 
 /******************************************************************************/
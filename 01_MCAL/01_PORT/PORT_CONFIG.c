@@ -7,6 +7,7 @@
 #include "PORT_CONFIG.h"
 #include "../../00_LIB/Platform_Types.h"
 
+#if COMPILATION_MODE == POST_COMPILATION_MODE
 
 
 uint8_t stPinsConfigurations[NUMBER_OF_PINS_IN_EACH_PORT * NUMBER_OF_PORTS] =
@@ -45,4 +46,5 @@ uint8_t stPinsConfigurations[NUMBER_OF_PINS_IN_EACH_PORT * NUMBER_OF_PORTS] =
 	DEAFULT,	/*Pin Number 31*/
 	DEAFULT		/*Pin Number 32*/
 	#endif
-};
\ No newline at end of file
+};
+#endif
@@ -111,6 +111,53 @@
 
 
 /******************************************************************************/
+/*
+* @brief pins configuration used in PRE_COMPILATION_MODE , each pin take one of
+*		the configuration pins options. PORT_vInit reduces them to constant
+*		DDR and PORT bytes so no table is kept in the flash. the sample
+*		image drives the pins of the LCD , the led and the software PWM and
+*		pulls up the switches of their shipped tables.
+*/
+/******************************************************************************/
+
+#define PORTA_PIN1_CFG			OUTPUT_LOW
+#define PORTA_PIN2_CFG			OUTPUT_LOW
+#define PORTA_PIN3_CFG			OUTPUT_LOW
+#define PORTA_PIN4_CFG			OUTPUT_LOW
+#define PORTA_PIN5_CFG			OUTPUT_LOW
+#define PORTA_PIN6_CFG			OUTPUT_LOW
+#define PORTA_PIN7_CFG			OUTPUT_LOW
+#define PORTA_PIN8_CFG			OUTPUT_LOW
+
+#define PORTB_PIN1_CFG			OUTPUT_LOW
+#define PORTB_PIN2_CFG			OUTPUT_LOW
+#define PORTB_PIN3_CFG			OUTPUT_LOW
+#define PORTB_PIN4_CFG			OUTPUT_LOW
+#define PORTB_PIN5_CFG			OUTPUT_LOW
+#define PORTB_PIN6_CFG			OUTPUT_LOW
+#define PORTB_PIN7_CFG			DEAFULT
+#define PORTB_PIN8_CFG			DEAFULT
+
+#define PORTC_PIN1_CFG			INPUT_INERNAL_PULL_UP
+#define PORTC_PIN2_CFG			INPUT_INERNAL_PULL_UP
+#define PORTC_PIN3_CFG			DEAFULT
+#define PORTC_PIN4_CFG			DEAFULT
+#define PORTC_PIN5_CFG			DEAFULT
+#define PORTC_PIN6_CFG			DEAFULT
+#define PORTC_PIN7_CFG			DEAFULT
+#define PORTC_PIN8_CFG			DEAFULT
+
+#if NUMBER_OF_PORTS == 4
+#define PORTD_PIN1_CFG			DEAFULT
+#define PORTD_PIN2_CFG			DEAFULT
+#define PORTD_PIN3_CFG			DEAFULT
+#define PORTD_PIN4_CFG			DEAFULT
+#define PORTD_PIN5_CFG			DEAFULT
+#define PORTD_PIN6_CFG			DEAFULT
+#define PORTD_PIN7_CFG			DEAFULT
+#define PORTD_PIN8_CFG			DEAFULT
+#endif
+
 
 #endif /* PORT_CONFIG_H_ */
 /******************************************************************************/
\ No newline at end of file
@@ -0,0 +1,102 @@
+/******************************************************************************/
+/**
+ * @file Critical.c
+ * @brief the state of the nested critical sections.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the sections are inline functions in Critical.h , this file only keeps
+ * the depth and the saved SREG of the nested sections.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "Critical.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the depth of the nested sections.
+*/
+uint8_t CRITICAL_u8Nesting = 0;
+
+/**
+*@brief the SREG saved by the first nested section.
+*/
+uint8_t CRITICAL_u8SavedSREG = 0;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
@@ -0,0 +1,222 @@
+/******************************************************************************/
+/**
+ * @file Critical.h
+ * @brief critical sections for the code shared between the main loop and the ISRs.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * CRITICAL_u8Enter saves SREG and disables the global interrupt , and
+ * CRITICAL_vExit restores the saved SREG , so the interrupt is enabled again
+ * only if it was enabled before the enter. the sections can be nested and
+ * can be used inside the ISRs. the nested variant keeps the saved SREG
+ * itself for the sections which start and end in different functions.
+ * the drivers never enable the global interrupt , the application enables it
+ * with CRITICAL_vEnableGlobal after all the drivers are initialized.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef CRITICAL_H_
+#define CRITICAL_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/**
+*@brief the depth of the nested sections and the SREG saved by the first one ,
+*	they are used by CRITICAL_vEnterNested and CRITICAL_vExitNested only.
+*/
+extern uint8_t CRITICAL_u8Nesting;
+extern uint8_t CRITICAL_u8SavedSREG;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC INLINE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				saves SREG and disables the global interrupt.
+ *
+ * @return				the saved SREG , pass it to CRITICAL_vExit.
+ *
+ * @note				it is two instructions (in , cli) , the memory
+ *					clobber keeps the compiler from moving the shared
+ *					variables accesses out of the section.
+ *
+ * @par EX:-
+ *	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+ *	LOC_u32Ticks = u32Ticks;
+ *	CRITICAL_vExit(LOC_u8SREG);
+*/
+/*----------------------------------------------------------------------------*/
+static inline uint8_t CRITICAL_u8Enter(void) __attribute__((always_inline));
+static inline uint8_t CRITICAL_u8Enter(void)
+{
+	uint8_t LOC_u8SREG;
+	__asm__ __volatile__ ("in %0, __SREG__" "\n\t"
+			      "cli"
+			      : "=r" (LOC_u8SREG)
+			      :
+			      : "memory");
+	return LOC_u8SREG;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				restores the SREG saved by CRITICAL_u8Enter.
+ *
+ * @param[in] Copy_u8SREG		the value returned by CRITICAL_u8Enter.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void CRITICAL_vExit(uint8_t Copy_u8SREG) __attribute__((always_inline));
+static inline void CRITICAL_vExit(uint8_t Copy_u8SREG)
+{
+	__asm__ __volatile__ ("out __SREG__, %0"
+			      :
+			      : "r" (Copy_u8SREG)
+			      : "memory");
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				enters a nested section , only the first enter
+ *					saves SREG.
+ *
+ * @note				each CRITICAL_vEnterNested needs one
+ *					CRITICAL_vExitNested.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void CRITICAL_vEnterNested(void) __attribute__((always_inline));
+static inline void CRITICAL_vEnterNested(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	if(CRITICAL_u8Nesting == 0)
+	{
+		CRITICAL_u8SavedSREG = LOC_u8SREG;
+	}
+	CRITICAL_u8Nesting++;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				exits a nested section , only the last exit
+ *					restores SREG.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void CRITICAL_vExitNested(void) __attribute__((always_inline));
+static inline void CRITICAL_vExitNested(void)
+{
+	CRITICAL_u8Nesting--;
+	if(CRITICAL_u8Nesting == 0)
+	{
+		CRITICAL_vExit(CRITICAL_u8SavedSREG);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				enables the global interrupt , called by the
+ *					application after the drivers initialization.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void CRITICAL_vEnableGlobal(void) __attribute__((always_inline));
+static inline void CRITICAL_vEnableGlobal(void)
+{
+	__asm__ __volatile__ ("sei" ::: "memory");
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				disables the global interrupt.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void CRITICAL_vDisableGlobal(void) __attribute__((always_inline));
+static inline void CRITICAL_vDisableGlobal(void)
+{
+	__asm__ __volatile__ ("cli" ::: "memory");
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* CRITICAL_H_ */
+/******************************************************************************/
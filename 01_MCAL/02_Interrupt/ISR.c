@@ -0,0 +1,671 @@
+/******************************************************************************/
+/**
+ * @file ISR.c
+ * @brief interrupt vectors dispatcher and deferred work queue.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * defines the vectors configured as ISR_DISPATCHED , each one calls the
+ * handler attached to it. the deferred works are kept in one ring queue for
+ * each priority , the ISRs are the producers and ISR_vRunWork is the only
+ * consumer so the consumer side needs no critical section.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "ISR.h"
+#include "ISR_CFG.h"
+#include "Critical.h"
+#include "../../00_LIB/BIT_MATH.h"
+#include "../03_Timers/Timers_CFG.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief used to wrap the queues indexes.
+*/
+#define		QUEUE_MASK							(ISR_QUEUE_SIZE - 1)
+
+/**
+*@brief Timer1 registers used by the trace.
+*/
+#define		TRACE_TCCR1A			*((volatile uint8_t *)0x4F)
+#define		TRACE_TCCR1B			*((volatile uint8_t *)0x4E)
+#define		TRACE_OCR1B			*((volatile uint16_t *)0x48)
+#define		TRACE_TIMSK			*((volatile uint8_t *)0x59)
+#define		TRACE_TIFR			*((volatile uint8_t *)0x58)
+
+/**
+*@brief the Timer1 compare B interrupt enable and flag bit.
+*/
+#define		TRACE_OCIE1B							3
+#define		TRACE_OCF1B							3
+
+/**
+*@brief the length of one line of the trace report.
+*/
+#define		TRACE_LINE_LENGTH						(24 + (ISR_TRACE_BINS * 6) + 40)
+
+/******************************************************************************/
+
+#if ISR_QUEUE_SIZE < 2 || ISR_QUEUE_SIZE > 128 || (ISR_QUEUE_SIZE & (ISR_QUEUE_SIZE - 1)) != 0
+#error ISR_QUEUE_SIZE must be a power of two from 2 to 128.
+#endif
+
+#if ISR_PRIORITIES < 1
+#error ISR_PRIORITIES must be 1 at least.
+#endif
+
+#if ISR_CALLBACKS_PRIORITY >= ISR_PRIORITIES
+#error ISR_CALLBACKS_PRIORITY must be less than ISR_PRIORITIES.
+#endif
+
+#if ISR_TRACE == ISR_ON
+
+#if TIMER1_ENABLE == ON
+#error Timer1 is the trace timebase , TIMER1_ENABLE must be OFF when ISR_TRACE is ISR_ON.
+#endif
+
+#if ISR_TRACE_PROBE == ISR_ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPB)
+#error the latency probe owns TIMER1 COMPB , it must not be dispatched.
+#endif
+
+#if ISR_TRACE_SLOTS < 1 || ISR_TRACE_SLOTS >= ISR_NUM_OF_VECTORS
+#error ISR_TRACE_SLOTS must be from 1 to 20.
+#endif
+
+#if ISR_TRACE_BINS < 1
+#error ISR_TRACE_BINS must be 1 at least.
+#endif
+
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/**
+*@brief one bit for each dispatched vector.
+*/
+#define		DISPATCHED_MASK			( ((uint32_t)ISR_IS_DISPATCHED(1) << 1) | \
+						((uint32_t)ISR_IS_DISPATCHED(2) << 2) | \
+						((uint32_t)ISR_IS_DISPATCHED(3) << 3) | \
+						((uint32_t)ISR_IS_DISPATCHED(4) << 4) | \
+						((uint32_t)ISR_IS_DISPATCHED(5) << 5) | \
+						((uint32_t)ISR_IS_DISPATCHED(6) << 6) | \
+						((uint32_t)ISR_IS_DISPATCHED(7) << 7) | \
+						((uint32_t)ISR_IS_DISPATCHED(8) << 8) | \
+						((uint32_t)ISR_IS_DISPATCHED(9) << 9) | \
+						((uint32_t)ISR_IS_DISPATCHED(10) << 10) | \
+						((uint32_t)ISR_IS_DISPATCHED(11) << 11) | \
+						((uint32_t)ISR_IS_DISPATCHED(12) << 12) | \
+						((uint32_t)ISR_IS_DISPATCHED(13) << 13) | \
+						((uint32_t)ISR_IS_DISPATCHED(14) << 14) | \
+						((uint32_t)ISR_IS_DISPATCHED(15) << 15) | \
+						((uint32_t)ISR_IS_DISPATCHED(16) << 16) | \
+						((uint32_t)ISR_IS_DISPATCHED(17) << 17) | \
+						((uint32_t)ISR_IS_DISPATCHED(18) << 18) | \
+						((uint32_t)ISR_IS_DISPATCHED(19) << 19) | \
+						((uint32_t)ISR_IS_DISPATCHED(20) << 20) )
+
+/**
+*@brief defines the vector _N as a call to its attached handler.
+*/
+#define		DISPATCHER(_N)									\
+void __vector_##_N(void) __attribute__((signal));						\
+void __vector_##_N(void)									\
+{												\
+	ISR_TRACE_ENTER(_N);									\
+	vDispatch(_N);										\
+	ISR_TRACE_EXIT(_N);									\
+}
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/**
+*@brief this struct used to save a function and its param , it is used for
+*	the vectors handlers and for the deferred works.
+*/
+typedef struct
+{
+	void (*ADD_pfFunc)(void*);
+	void * vpFuncParam;
+} stISRFunc_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the handler of each vector.
+*/
+static stISRFunc_t astHandlers[ISR_NUM_OF_VECTORS];
+
+/**
+*@brief the queue of each priority , the head is moved by the producers and
+*	the tail by the consumer only.
+*/
+static stISRFunc_t astQueues[ISR_PRIORITIES][ISR_QUEUE_SIZE];
+static volatile uint8_t au8Head[ISR_PRIORITIES];
+static volatile uint8_t au8Tail[ISR_PRIORITIES];
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+#if ISR_TRACE == ISR_ON
+
+/**
+*@brief the trace slot + 1 of each vector , 0 means the vector has no slot.
+*/
+static uint8_t au8TraceSlot[ISR_NUM_OF_VECTORS];
+
+/**
+*@brief the vector of each used slot and the number of used slots.
+*/
+static uint8_t au8TraceVector[ISR_TRACE_SLOTS];
+static uint8_t u8TraceUsedSlots;
+
+/**
+*@brief the execution time statistics of the slots and the entry latency
+*	statistics of the probe.
+*/
+static ISR_stTraceStats_t astTraceStats[ISR_TRACE_SLOTS];
+static ISR_stTraceStats_t stTraceLatency;
+
+/**
+*@brief the execution time of all the traced vectors , it is never halved or
+*	cleared so the time between two reads is their difference.
+*/
+static volatile uint32_t u32TraceTotalTicks;
+
+#if ISR_TRACE_PROBE == ISR_ON
+/**
+*@brief random jitter added to the probe period , so the probe doesn't
+*	lock on the phase of a periodic interrupt.
+*/
+static uint8_t u8ProbeJitter = 1;
+#endif
+
+#endif
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+*@brief calls the handler of the vector if it is attached.
+*/
+static inline void vDispatch(uint8_t Copy_u8Vector) __attribute__((always_inline));
+
+#if ISR_TRACE == ISR_ON
+/**
+*@brief adds one time to the statistics.
+*/
+static void vTraceAdd(ISR_stTraceStats_t * ADD_pstStats, uint16_t Copy_u16Ticks);
+
+/**
+*@brief writes one statistics line , returns its length.
+*/
+static uint16_t u16TraceLine(uint8_t * ADD_pu8Line, uint8_t Copy_u8Vector, const ISR_stTraceStats_t * ADD_pstStats);
+
+/**
+*@brief appends a text or a decimal number to the line , returns the new length.
+*/
+static uint16_t u16AppendText(uint8_t * ADD_pu8Line, uint16_t Copy_u16Length, const char * ADD_pchText);
+static uint16_t u16AppendNumber(uint8_t * ADD_pu8Line, uint16_t Copy_u16Length, uint32_t Copy_u32Number);
+
+#if ISR_TRACE_PROBE == ISR_ON
+/**
+*@brief the latency probe , Timer1 compare B interrupt service routine.
+*/
+void __vector_8(void) __attribute__((signal));
+#endif
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static inline void vDispatch(uint8_t Copy_u8Vector)
+{
+	if(astHandlers[Copy_u8Vector].ADD_pfFunc != NULL)
+	{
+		astHandlers[Copy_u8Vector].ADD_pfFunc(astHandlers[Copy_u8Vector].vpFuncParam);
+	}
+}
+
+#if ISR_TRACE == ISR_ON
+
+static void vTraceAdd(ISR_stTraceStats_t * ADD_pstStats, uint16_t Copy_u16Ticks)
+{
+	/*keep the average right when the counter is full*/
+	if(ADD_pstStats->u16Count == 0xFFFF)
+	{
+		ADD_pstStats->u16Count >>= 1;
+		ADD_pstStats->u32Sum   >>= 1;
+	}
+	if(ADD_pstStats->u16Count == 0 || Copy_u16Ticks < ADD_pstStats->u16Min)
+	{
+		ADD_pstStats->u16Min = Copy_u16Ticks;
+	}
+	if(Copy_u16Ticks > ADD_pstStats->u16Max)
+	{
+		ADD_pstStats->u16Max = Copy_u16Ticks;
+	}
+	ADD_pstStats->u16Count++;
+	ADD_pstStats->u32Sum += Copy_u16Ticks;
+
+	uint16_t LOC_u16Bin = Copy_u16Ticks >> ISR_TRACE_BIN_SHIFT;
+	if(LOC_u16Bin >= ISR_TRACE_BINS)
+	{
+		LOC_u16Bin = ISR_TRACE_BINS - 1;
+	}
+	if(ADD_pstStats->au16Histogram[LOC_u16Bin] != 0xFFFF)
+	{
+		ADD_pstStats->au16Histogram[LOC_u16Bin]++;
+	}
+}
+
+static uint16_t u16AppendText(uint8_t * ADD_pu8Line, uint16_t Copy_u16Length, const char * ADD_pchText)
+{
+	while(*ADD_pchText != '\0')
+	{
+		ADD_pu8Line[Copy_u16Length] = (uint8_t)*ADD_pchText;
+		Copy_u16Length++;
+		ADD_pchText++;
+	}
+	return Copy_u16Length;
+}
+
+static uint16_t u16AppendNumber(uint8_t * ADD_pu8Line, uint16_t Copy_u16Length, uint32_t Copy_u32Number)
+{
+	uint8_t LOC_au8Digits[10];
+	uint8_t LOC_u8Count = 0;
+	do
+	{
+		LOC_au8Digits[LOC_u8Count] = (uint8_t)('0' + (Copy_u32Number % 10));
+		LOC_u8Count++;
+		Copy_u32Number /= 10;
+	} while(Copy_u32Number != 0);
+
+	/*the digits are taken from the right*/
+	while(LOC_u8Count != 0)
+	{
+		LOC_u8Count--;
+		ADD_pu8Line[Copy_u16Length] = LOC_au8Digits[LOC_u8Count];
+		Copy_u16Length++;
+	}
+	return Copy_u16Length;
+}
+
+static uint16_t u16TraceLine(uint8_t * ADD_pu8Line, uint8_t Copy_u8Vector, const ISR_stTraceStats_t * ADD_pstStats)
+{
+	uint16_t LOC_u16Length = 0;
+	if(Copy_u8Vector == ISR_TRACE_LATENCY)
+	{
+		LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length,"LAT");
+	}
+	else
+	{
+		LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length,"V");
+		LOC_u16Length = u16AppendNumber(ADD_pu8Line,LOC_u16Length,Copy_u8Vector);
+	}
+	LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length," N=");
+	LOC_u16Length = u16AppendNumber(ADD_pu8Line,LOC_u16Length,ADD_pstStats->u16Count);
+	LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length," MIN=");
+	LOC_u16Length = u16AppendNumber(ADD_pu8Line,LOC_u16Length,ADD_pstStats->u16Min);
+	LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length," MAX=");
+	LOC_u16Length = u16AppendNumber(ADD_pu8Line,LOC_u16Length,ADD_pstStats->u16Max);
+	LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length," AVG=");
+	LOC_u16Length = u16AppendNumber(ADD_pu8Line,LOC_u16Length,
+			(ADD_pstStats->u16Count == 0) ? 0 : (ADD_pstStats->u32Sum / ADD_pstStats->u16Count));
+	LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length," H=");
+	for(uint8_t LOC_u8Bin = 0 ; LOC_u8Bin < ISR_TRACE_BINS ; LOC_u8Bin++)
+	{
+		if(LOC_u8Bin != 0)
+		{
+			LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length,",");
+		}
+		LOC_u16Length = u16AppendNumber(ADD_pu8Line,LOC_u16Length,ADD_pstStats->au16Histogram[LOC_u8Bin]);
+	}
+	LOC_u16Length = u16AppendText(ADD_pu8Line,LOC_u16Length,"\r\n");
+	return LOC_u16Length;
+}
+
+#if ISR_TRACE_PROBE == ISR_ON
+void __vector_8(void)
+{
+	/*the compare match was at OCR1B , so the counter now is the latency*/
+	uint16_t LOC_u16Match = TRACE_OCR1B;
+	vTraceAdd(&stTraceLatency,(uint16_t)(ISR_TRACE_TIMER - LOC_u16Match));
+
+	/*8 bit LFSR for the jitter of the next probe*/
+	u8ProbeJitter = (uint8_t)((u8ProbeJitter >> 1) ^ ((uint8_t)(-(u8ProbeJitter & 1)) & 0xB8));
+	TRACE_OCR1B = LOC_u16Match + ISR_TRACE_PROBE_TICKS + u8ProbeJitter;
+}
+#endif
+
+#endif
+
+#if ISR_IS_DISPATCHED(1)
+DISPATCHER(1)
+#endif
+#if ISR_IS_DISPATCHED(2)
+DISPATCHER(2)
+#endif
+#if ISR_IS_DISPATCHED(3)
+DISPATCHER(3)
+#endif
+#if ISR_IS_DISPATCHED(4)
+DISPATCHER(4)
+#endif
+#if ISR_IS_DISPATCHED(5)
+DISPATCHER(5)
+#endif
+#if ISR_IS_DISPATCHED(6)
+DISPATCHER(6)
+#endif
+#if ISR_IS_DISPATCHED(7)
+DISPATCHER(7)
+#endif
+#if ISR_IS_DISPATCHED(8)
+DISPATCHER(8)
+#endif
+#if ISR_IS_DISPATCHED(9)
+DISPATCHER(9)
+#endif
+#if ISR_IS_DISPATCHED(10)
+DISPATCHER(10)
+#endif
+#if ISR_IS_DISPATCHED(11)
+DISPATCHER(11)
+#endif
+#if ISR_IS_DISPATCHED(12)
+DISPATCHER(12)
+#endif
+#if ISR_IS_DISPATCHED(13)
+DISPATCHER(13)
+#endif
+#if ISR_IS_DISPATCHED(14)
+DISPATCHER(14)
+#endif
+#if ISR_IS_DISPATCHED(15)
+DISPATCHER(15)
+#endif
+#if ISR_IS_DISPATCHED(16)
+DISPATCHER(16)
+#endif
+#if ISR_IS_DISPATCHED(17)
+DISPATCHER(17)
+#endif
+#if ISR_IS_DISPATCHED(18)
+DISPATCHER(18)
+#endif
+#if ISR_IS_DISPATCHED(19)
+DISPATCHER(19)
+#endif
+#if ISR_IS_DISPATCHED(20)
+DISPATCHER(20)
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+ISR_enuErrors_t ISR_enuAttach(uint8_t Copy_u8Vector, void (*ADD_pfHandler)(void*), void * ADD_pvParam)
+{
+	ISR_enuErrors_t RET_enuErrorStatus = ISR_enuOK;					/*return the status of function is working right or not */
+	if(Copy_u8Vector == 0 || Copy_u8Vector >= ISR_NUM_OF_VECTORS)			/*Check inValid vector*/
+	{
+		RET_enuErrorStatus = ISR_enuInvalidVector;
+	}
+	else if(((DISPATCHED_MASK >> Copy_u8Vector) & 1) == 0)				/*the vector is defined by its driver*/
+	{
+		RET_enuErrorStatus = ISR_enuNotDispatched;
+	}
+	else if(ADD_pfHandler == NULL)
+	{
+		RET_enuErrorStatus = ISR_enuNullPtr;					/*return null function pointer passed to the function*/
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();							/*the vector can't see half attached handler*/
+		astHandlers[Copy_u8Vector].ADD_pfFunc  = ADD_pfHandler;
+		astHandlers[Copy_u8Vector].vpFuncParam = ADD_pvParam;
+		CRITICAL_vExit(LOC_u8SREG);								/*restore the interrupt state*/
+	}
+	return RET_enuErrorStatus;
+}
+
+
+ISR_enuErrors_t ISR_enuPostWork(uint8_t Copy_u8Priority, void (*ADD_pfWork)(void*), void * ADD_pvParam)
+{
+	ISR_enuErrors_t RET_enuErrorStatus = ISR_enuOK;					/*return the status of function is working right or not */
+	if(Copy_u8Priority >= ISR_PRIORITIES)
+	{
+		RET_enuErrorStatus = ISR_enuInvalidPriority;
+	}
+	else if(ADD_pfWork == NULL)
+	{
+		RET_enuErrorStatus = ISR_enuNullPtr;					/*return null function pointer passed to the function*/
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();							/*the main loop and the ISRs may post together*/
+		uint8_t LOC_u8Head = au8Head[Copy_u8Priority];
+		if((uint8_t)(LOC_u8Head - au8Tail[Copy_u8Priority]) >= ISR_QUEUE_SIZE)
+		{
+			RET_enuErrorStatus = ISR_enuQueueFull;
+		}
+		else
+		{
+			astQueues[Copy_u8Priority][LOC_u8Head & QUEUE_MASK].ADD_pfFunc  = ADD_pfWork;
+			astQueues[Copy_u8Priority][LOC_u8Head & QUEUE_MASK].vpFuncParam = ADD_pvParam;
+			au8Head[Copy_u8Priority] = LOC_u8Head + 1;
+		}
+		CRITICAL_vExit(LOC_u8SREG);								/*restore the interrupt state*/
+	}
+	return RET_enuErrorStatus;
+}
+
+
+void ISR_vRunWork(void)
+{
+	uint8_t LOC_u8Priority = 0;
+	while(LOC_u8Priority < ISR_PRIORITIES)
+	{
+		uint8_t LOC_u8Tail = au8Tail[LOC_u8Priority];
+		if(au8Head[LOC_u8Priority] == LOC_u8Tail)
+		{
+			/*this priority is empty , check the next one*/
+			LOC_u8Priority++;
+		}
+		else
+		{
+			/*the producers never write the entry at the tail , so it is read without critical section*/
+			stISRFunc_t LOC_stWork = astQueues[LOC_u8Priority][LOC_u8Tail & QUEUE_MASK];
+			au8Tail[LOC_u8Priority] = LOC_u8Tail + 1;
+			LOC_stWork.ADD_pfFunc(LOC_stWork.vpFuncParam);
+
+			/*a higher work may be posted while this one was running*/
+			LOC_u8Priority = 0;
+		}
+	}
+}
+
+
+#if ISR_TRACE == ISR_ON
+
+void ISR_vTraceInit(void)
+{
+	/*Timer1 in normal mode , it is never cleared*/
+	TRACE_TCCR1A = 0;
+	TRACE_TCCR1B = ISR_TRACE_PRESCALER;
+	ISR_TRACE_TIMER = 0;
+
+	#if ISR_TRACE_PROBE == ISR_ON
+	TRACE_OCR1B = ISR_TRACE_PROBE_TICKS;
+	TRACE_TIFR  = (1 << TRACE_OCF1B);					/*clear the old flag by writing one*/
+	SET_BIT(TRACE_TIMSK,TRACE_OCIE1B);
+	#endif
+}
+
+
+void ISR_vTraceRecord(uint8_t Copy_u8Vector, uint16_t Copy_u16Ticks)
+{
+	u32TraceTotalTicks += Copy_u16Ticks;
+	uint8_t LOC_u8Slot = au8TraceSlot[Copy_u8Vector];
+	if(LOC_u8Slot == 0 && u8TraceUsedSlots < ISR_TRACE_SLOTS)
+	{
+		/*the first interrupt of this vector takes a new slot*/
+		au8TraceVector[u8TraceUsedSlots] = Copy_u8Vector;
+		u8TraceUsedSlots++;
+		LOC_u8Slot = u8TraceUsedSlots;
+		au8TraceSlot[Copy_u8Vector] = LOC_u8Slot;
+	}
+	if(LOC_u8Slot != 0)
+	{
+		vTraceAdd(&astTraceStats[LOC_u8Slot - 1],Copy_u16Ticks);
+	}
+}
+
+
+ISR_enuErrors_t ISR_enuTraceGet(uint8_t Copy_u8Vector, ISR_stTraceStats_t * ADD_pstStats)
+{
+	ISR_enuErrors_t RET_enuErrorStatus = ISR_enuOK;					/*return the status of function is working right or not */
+	if(Copy_u8Vector >= ISR_NUM_OF_VECTORS)					/*Check inValid vector*/
+	{
+		RET_enuErrorStatus = ISR_enuInvalidVector;
+	}
+	else if(ADD_pstStats == NULL)
+	{
+		RET_enuErrorStatus = ISR_enuNullPtr;
+	}
+	else if(Copy_u8Vector != ISR_TRACE_LATENCY && au8TraceSlot[Copy_u8Vector] == 0)
+	{
+		RET_enuErrorStatus = ISR_enuNotTraced;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();							/*the vectors can't change the statistics while copying*/
+		if(Copy_u8Vector == ISR_TRACE_LATENCY)
+		{
+			*ADD_pstStats = stTraceLatency;
+		}
+		else
+		{
+			*ADD_pstStats = astTraceStats[au8TraceSlot[Copy_u8Vector] - 1];
+		}
+		CRITICAL_vExit(LOC_u8SREG);								/*restore the interrupt state*/
+	}
+	return RET_enuErrorStatus;
+}
+
+
+void ISR_vTraceReset(void)
+{
+	const ISR_stTraceStats_t LOC_stEmpty = {0};
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();								/*save the interrupt state*/
+	for(uint8_t LOC_u8Vector = 0 ; LOC_u8Vector < ISR_NUM_OF_VECTORS ; LOC_u8Vector++)
+	{
+		au8TraceSlot[LOC_u8Vector] = 0;
+	}
+	for(uint8_t LOC_u8Slot = 0 ; LOC_u8Slot < ISR_TRACE_SLOTS ; LOC_u8Slot++)
+	{
+		astTraceStats[LOC_u8Slot] = LOC_stEmpty;
+	}
+	stTraceLatency   = LOC_stEmpty;
+	u8TraceUsedSlots = 0;
+	CRITICAL_vExit(LOC_u8SREG);									/*restore the interrupt state*/
+}
+
+
+uint32_t ISR_u32TraceGetTotalTicks(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();								/*save the interrupt state*/
+	uint32_t LOC_u32Ticks = u32TraceTotalTicks;
+	CRITICAL_vExit(LOC_u8SREG);									/*restore the interrupt state*/
+	return LOC_u32Ticks;
+}
+
+
+void ISR_vTraceReport(void (*ADD_pfWrite)(const uint8_t * ADD_pu8Line, uint16_t Copy_u16Length))
+{
+	if(ADD_pfWrite != NULL)
+	{
+		uint8_t LOC_au8Line[TRACE_LINE_LENGTH];
+		ISR_stTraceStats_t LOC_stStats;
+		uint16_t LOC_u16Length = 0;
+
+		/*the time of one tick in ns*/
+		static const uint16_t LOC_au16Prescalers[] = {0, 1, 8, 64};
+		LOC_u16Length = u16AppendText(LOC_au8Line,LOC_u16Length,"TICK=");
+		LOC_u16Length = u16AppendNumber(LOC_au8Line,LOC_u16Length,
+				(uint32_t)((1000000000ULL * LOC_au16Prescalers[ISR_TRACE_PRESCALER]) / F_CPU));
+		LOC_u16Length = u16AppendText(LOC_au8Line,LOC_u16Length,"ns\r\n");
+		ADD_pfWrite(LOC_au8Line,LOC_u16Length);
+
+		ISR_enuTraceGet(ISR_TRACE_LATENCY,&LOC_stStats);
+		ADD_pfWrite(LOC_au8Line,u16TraceLine(LOC_au8Line,ISR_TRACE_LATENCY,&LOC_stStats));
+
+		for(uint8_t LOC_u8Slot = 0 ; LOC_u8Slot < u8TraceUsedSlots ; LOC_u8Slot++)
+		{
+			uint8_t LOC_u8Vector = au8TraceVector[LOC_u8Slot];
+			if(ISR_enuTraceGet(LOC_u8Vector,&LOC_stStats) == ISR_enuOK)
+			{
+				ADD_pfWrite(LOC_au8Line,u16TraceLine(LOC_au8Line,LOC_u8Vector,&LOC_stStats));
+			}
+		}
+	}
+}
+
+#endif
+
+/******************************************************************************/
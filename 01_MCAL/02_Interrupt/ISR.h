@@ -0,0 +1,350 @@
+/******************************************************************************/
+/**
+ * @file ISR.h
+ * @brief interrupt vectors dispatcher and deferred work queue.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the dispatcher owns the vectors configured as ISR_DISPATCHED in ISR_CFG.h
+ * and calls the handler attached to each one at run time.
+ * the ISRs keep only the urgent part (top half) and post the long part
+ * (bottom half) to a queue of the wanted priority , the queues are drained
+ * from the main loop by ISR_vRunWork , the highest priority first.
+ * with ISR_TRACE the vectors execution time and the interrupts entry latency
+ * are measured with Timer1 and can be sent as text over the UART.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef ISR_H_
+#define ISR_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "ISR_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*				 ATMEGA32 VECTORS NUMBERS		      */
+/******************************************************************************/
+
+#define					ISR_VECT_INT0				1
+#define					ISR_VECT_INT1				2
+#define					ISR_VECT_INT2				3
+#define					ISR_VECT_TIMER2_COMP			4
+#define					ISR_VECT_TIMER2_OVF			5
+#define					ISR_VECT_TIMER1_CAPT			6
+#define					ISR_VECT_TIMER1_COMPA			7
+#define					ISR_VECT_TIMER1_COMPB			8
+#define					ISR_VECT_TIMER1_OVF			9
+#define					ISR_VECT_TIMER0_COMP			10
+#define					ISR_VECT_TIMER0_OVF			11
+#define					ISR_VECT_SPI_STC			12
+#define					ISR_VECT_USART_RXC			13
+#define					ISR_VECT_USART_UDRE			14
+#define					ISR_VECT_USART_TXC			15
+#define					ISR_VECT_ADC				16
+#define					ISR_VECT_EE_RDY				17
+#define					ISR_VECT_ANA_COMP			18
+#define					ISR_VECT_TWI				19
+#define					ISR_VECT_SPM_RDY			20
+
+/**
+*@brief the number of the vectors with the reset vector.
+*/
+#define					ISR_NUM_OF_VECTORS			21
+
+/**
+*@brief used with ISR_enuTraceGet to get the entry latency measured by the probe.
+*/
+#define					ISR_TRACE_LATENCY			0
+
+/**
+*@brief the counter of Timer1 , the timebase of the trace.
+*/
+#define					ISR_TRACE_TIMER				(*((volatile uint16_t *)0x4C))
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief used by the drivers to know if the vector is defined by the dispatcher
+*	(the driver attaches its handler) or by the driver itself.
+*	EX:- #if ISR_IS_DISPATCHED(ISR_VECT_ADC)
+*/
+#define ISR_IS_DISPATCHED(_VECT)		ISR_IS_DISPATCHED_(_VECT)
+#define ISR_IS_DISPATCHED_(_VECT)		(ISR_DISPATCH_##_VECT == ISR_DISPATCHED)
+
+/**
+*@brief put at the start and at the end of each vector to measure its
+*	execution time , they are empty if ISR_TRACE is ISR_OFF.
+*	EX:- ISR_TRACE_ENTER(ISR_VECT_ADC); ... ISR_TRACE_EXIT(ISR_VECT_ADC);
+*/
+#if ISR_TRACE == ISR_ON
+#define ISR_TRACE_ENTER(_VECT)			uint16_t LOC_u16TraceStart = ISR_TRACE_TIMER
+#define ISR_TRACE_EXIT(_VECT)			ISR_vTraceRecord((_VECT),(uint16_t)(ISR_TRACE_TIMER - LOC_u16TraceStart))
+#else
+#define ISR_TRACE_ENTER(_VECT)
+#define ISR_TRACE_EXIT(_VECT)
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/*
+*@brief these are all dispatcher errors which may occur when using APIs in wrong way.
+*/
+typedef enum
+{
+	/**
+	*@brief returned if the function did it functionality correctly.
+	*/
+	ISR_enuOK,
+
+	/**
+	*@brief returned if the vector number is out of range.
+	*/
+	ISR_enuInvalidVector,
+
+	/**
+	*@brief returned if the vector is not configured as ISR_DISPATCHED.
+	*/
+	ISR_enuNotDispatched,
+
+	/**
+	*@brief returned if the priority is out of ISR_PRIORITIES.
+	*/
+	ISR_enuInvalidPriority,
+
+	/**
+	*@brief returned if the queue of the priority is full , the work is not posted.
+	*/
+	ISR_enuQueueFull,
+
+	/**
+	*@brief returned if the vector has no trace slot (it is not entered yet
+	*	or all slots are used).
+	*/
+	ISR_enuNotTraced,
+
+	/**
+	*@brief  returned if null pinter to function passed
+	*/
+	ISR_enuNullPtr
+
+} ISR_enuErrors_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/**
+*@brief the statistics of one vector , all times are in trace ticks.
+*/
+typedef struct
+{
+	uint16_t u16Count;
+	uint16_t u16Min;
+	uint16_t u16Max;
+	uint32_t u32Sum;
+	uint16_t au16Histogram[ISR_TRACE_BINS];
+} ISR_stTraceStats_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief				attaches a handler to a dispatched vector.
+*
+* @param[in] Copy_u8Vector		the vector number (ISR_VECT_ADC , ISR_VECT_TWI ..).
+*
+* @param[in] ADD_pfHandler		the function which called inside the interrupt.
+*
+* @param[in] ADD_pvParam		generic pointer passed to the handler.
+*
+* @return the dispatcher error status.
+*/
+ISR_enuErrors_t ISR_enuAttach(uint8_t Copy_u8Vector, void (*ADD_pfHandler)(void*), void * ADD_pvParam);
+
+/**
+* @brief				posts a work to be executed later from the main loop.
+*
+* @param[in] Copy_u8Priority		the priority of the work , 0 is the highest.
+*
+* @param[in] ADD_pfWork		the function of the work.
+*
+* @param[in] ADD_pvParam		generic pointer passed to the work.
+*
+* @return the dispatcher error status.
+*
+* @note					it can be called from the ISRs and from the main loop.
+*/
+ISR_enuErrors_t ISR_enuPostWork(uint8_t Copy_u8Priority, void (*ADD_pfWork)(void*), void * ADD_pvParam);
+
+/**
+* @brief				executes all posted works , the highest priority
+*					first. a work posted while a lower work is running
+*					is executed before the next lower work.
+*
+* @note					call it from the main loop.
+*/
+void ISR_vRunWork(void);
+
+/**
+* @brief				starts Timer1 as the free running timebase of the
+*					trace and starts the latency probe.
+*
+* @note					the global interrupt is not enabled here.
+*/
+void ISR_vTraceInit(void);
+
+/**
+* @brief				adds one execution time to the statistics of the vector.
+*
+* @param[in] Copy_u8Vector		the vector number.
+*
+* @param[in] Copy_u16Ticks		the execution time in trace ticks.
+*
+* @note					called by ISR_TRACE_EXIT inside the vectors only.
+*/
+void ISR_vTraceRecord(uint8_t Copy_u8Vector, uint16_t Copy_u16Ticks);
+
+/**
+* @brief				gets a copy of the statistics of one vector.
+*
+* @param[in] Copy_u8Vector		the vector number or ISR_TRACE_LATENCY.
+*
+* @param[out] ADD_pstStats		the statistics.
+*
+* @return the dispatcher error status.
+*/
+ISR_enuErrors_t ISR_enuTraceGet(uint8_t Copy_u8Vector, ISR_stTraceStats_t * ADD_pstStats);
+
+/**
+* @brief				clears all the statistics and frees the slots.
+*/
+void ISR_vTraceReset(void);
+
+/**
+* @brief				gets the execution time of all the traced vectors
+*					in trace ticks , it wraps and it is not cleared by
+*					ISR_vTraceReset.
+*
+* @note					the time of the interrupts in a period is the
+*					difference of two reads.
+*/
+uint32_t ISR_u32TraceGetTotalTicks(void);
+
+/**
+* @brief				writes the statistics as text , one line for the
+*					latency and one line for each traced vector.
+*
+* @param[in] ADD_pfWrite		the function which sends one line , EX:- a
+*					function which calls Uart_vTransmitBuff.
+*
+* @par EX:-
+*	TICK=1000ns
+*	LAT N=310 MIN=2 MAX=41 AVG=3 H=305,2,1,0,0,2,0,0
+*	V16 N=120 MIN=6 MAX=9 AVG=7 H=0,120,0,0,0,0,0,0
+*/
+void ISR_vTraceReport(void (*ADD_pfWrite)(const uint8_t * ADD_pu8Line, uint16_t Copy_u16Length));
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC INLINE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				used by the drivers ISRs to call the user callbacks ,
+ *					it posts the callback if ISR_DEFER_CALLBACKS is ISR_ON
+ *					otherwise it calls it directly.
+ *
+ * @note				if the queue is full the callback is called directly
+ *					, a callback is never lost.
+*/
+/*----------------------------------------------------------------------------*/
+static inline void ISR_vCallBack(void (*ADD_pfCallBack)(void*), void * ADD_pvParam) __attribute__((always_inline));
+static inline void ISR_vCallBack(void (*ADD_pfCallBack)(void*), void * ADD_pvParam)
+{
+	if(ADD_pfCallBack != NULL)
+	{
+	#if ISR_DEFER_CALLBACKS == ISR_ON
+		if(ISR_enuPostWork(ISR_CALLBACKS_PRIORITY,ADD_pfCallBack,ADD_pvParam) != ISR_enuOK)
+		{
+			ADD_pfCallBack(ADD_pvParam);
+		}
+	#else
+		ADD_pfCallBack(ADD_pvParam);
+	#endif
+	}
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* ISR_H_ */
+/******************************************************************************/
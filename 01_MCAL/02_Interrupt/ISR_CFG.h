@@ -0,0 +1,225 @@
+/******************************************************************************/
+/**
+ * @file ISR_CFG.h
+ * @brief configuration of the interrupt vectors dispatcher and the deferred work queue.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * used to select which vectors are owned by the dispatcher (the handler is
+ * attached at run time) and which are defined directly by their drivers , and
+ * to configure the deferred work queue which the ISRs post to.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef ISR_CFG_H_
+#define ISR_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*				 VECTORS OWNERS OPTIONS			      */
+/******************************************************************************/
+
+/**
+*@brief the driver defines the vector itself , no run time indirection.
+*/
+#define					ISR_DIRECT				0
+
+/**
+*@brief the dispatcher defines the vector and calls the handler attached
+*	with ISR_enuAttach , the driver attaches its own handler at init.
+*/
+#define					ISR_DISPATCHED				1
+
+/******************************************************************************/
+
+
+/******************************************************************************/
+/*				 VECTORS CONFIGURATION			      */
+/******************************************************************************/
+
+#define					ISR_DISPATCH_1				ISR_DIRECT	/*INT0*/
+#define					ISR_DISPATCH_2				ISR_DIRECT	/*INT1*/
+#define					ISR_DISPATCH_3				ISR_DIRECT	/*INT2*/
+#define					ISR_DISPATCH_4				ISR_DIRECT	/*TIMER2 COMP*/
+#define					ISR_DISPATCH_5				ISR_DIRECT	/*TIMER2 OVF*/
+#define					ISR_DISPATCH_6				ISR_DIRECT	/*TIMER1 CAPT*/
+#define					ISR_DISPATCH_7				ISR_DIRECT	/*TIMER1 COMPA*/
+#define					ISR_DISPATCH_8				ISR_DIRECT	/*TIMER1 COMPB*/
+#define					ISR_DISPATCH_9				ISR_DIRECT	/*TIMER1 OVF*/
+#define					ISR_DISPATCH_10				ISR_DIRECT	/*TIMER0 COMP*/
+#define					ISR_DISPATCH_11				ISR_DIRECT	/*TIMER0 OVF*/
+#define					ISR_DISPATCH_12				ISR_DIRECT	/*SPI STC*/
+#define					ISR_DISPATCH_13				ISR_DIRECT	/*USART RXC*/
+#define					ISR_DISPATCH_14				ISR_DIRECT	/*USART UDRE*/
+#define					ISR_DISPATCH_15				ISR_DIRECT	/*USART TXC*/
+#define					ISR_DISPATCH_16				ISR_DIRECT	/*ADC*/
+#define					ISR_DISPATCH_17				ISR_DIRECT	/*EE RDY*/
+#define					ISR_DISPATCH_18				ISR_DIRECT	/*ANA COMP*/
+#define					ISR_DISPATCH_19				ISR_DIRECT	/*TWI*/
+#define					ISR_DISPATCH_20				ISR_DIRECT	/*SPM RDY*/
+
+/******************************************************************************/
+
+
+/******************************************************************************/
+/*				 DEFERRED WORK CONFIGURATION		      */
+/******************************************************************************/
+
+/**
+*@brief used to enable or disable an option.
+*/
+#define					ISR_ON					1
+#define					ISR_OFF					0
+
+/**
+*@brief the number of the priority levels , 0 is the highest priority.
+*/
+#define					ISR_PRIORITIES				3
+
+/**
+*@brief the size of the queue of each priority , it must be a power of two.
+*/
+#define					ISR_QUEUE_SIZE				8
+
+/**
+*@brief ISR_ON to make the drivers post the user callbacks to the queue instead
+*	of calling them inside the interrupt.
+*/
+#define					ISR_DEFER_CALLBACKS			ISR_OFF
+
+/**
+*@brief the priority of the deferred user callbacks.
+*/
+#define					ISR_CALLBACKS_PRIORITY			1
+
+/******************************************************************************/
+
+
+/******************************************************************************/
+/*				 TRACE CONFIGURATION			      */
+/******************************************************************************/
+
+/**
+*@brief ISR_ON to measure the execution time of the vectors and the interrupts
+*	entry latency , Timer1 becomes the free running timebase of the trace
+*	so it can't be used by the timers drivers.
+*/
+#define					ISR_TRACE				ISR_OFF
+
+/**
+*@brief the clock of the trace timebase , with 8MHz ISR_TRACE_CLK_8 gives
+*	1us for each tick and 65ms before the counter wraps.
+*/
+#define					ISR_TRACE_CLK_1				1
+#define					ISR_TRACE_CLK_8				2
+#define					ISR_TRACE_CLK_64			3
+
+#define					ISR_TRACE_PRESCALER			ISR_TRACE_CLK_8
+
+/**
+*@brief the number of the vectors which can be traced , the vectors take
+*	the slots in the order of their first interrupt.
+*/
+#define					ISR_TRACE_SLOTS				8
+
+/**
+*@brief the histogram of each vector has ISR_TRACE_BINS bins and each bin is
+*	(2^ISR_TRACE_BIN_SHIFT) ticks , the last bin counts all larger times.
+*/
+#define					ISR_TRACE_BINS				8
+#define					ISR_TRACE_BIN_SHIFT			3
+
+/**
+*@brief ISR_ON to measure the entry latency with the Timer1 compare B
+*	interrupt , it is fired every ISR_TRACE_PROBE_TICKS (with a small random
+*	jitter) and measures how late it is entered after its compare match.
+*/
+#define					ISR_TRACE_PROBE				ISR_ON
+#define					ISR_TRACE_PROBE_TICKS			1000
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* ISR_CFG_H_ */
+/******************************************************************************/
@@ -34,6 +34,9 @@
 /******************************************************************************/
 #include "Interrupt.h"
 #include "Interrupt_CFG.h"
+#include "ISR.h"
+#include "Critical.h"
+#include "../03_Timers/Timers_CFG.h"
 #include "../../00_LIB/BIT_MATH.h"
 /******************************************************************************/
 
@@ -45,11 +48,6 @@
 /*                    REGISTERS ADDRESSES				                      */
 /******************************************************************************/
 
-/**
-*@brief Status Register is used for enable Global Interrupt.
-*/
-#define		SREG				*((volatile uint8_t *)0x5F)
-
 /**
 *@brief General Interrupt Control Register used for enable/disable all 
 *		external interrupts.
@@ -73,17 +71,20 @@
 */
 #define		GIFR				*((volatile uint8_t *)0x5A)
 
+/**
+*@brief Timer1 control registers and counter , Timer1 is the free running
+*		timebase of the edge capture.
+*/
+#define		TCCR1A				*((volatile uint8_t *)0x4F)
+#define		TCCR1B				*((volatile uint8_t *)0x4E)
+#define		TCNT1				*((volatile uint16_t *)0x4C)
+
 /******************************************************************************/
 
 /******************************************************************************/
 /*	        Symbolic Constants for registers bits			      */
 /******************************************************************************/
 
-/**
-*@brief Global Interrupt Enable in bit 7 int SREG register.
-*/
-#define		SERG_INT_EN_BIT							7			
-
 /**
 *@brief Bit 7  INT1: External Interrupt Request 1 Enable.
 */
@@ -153,6 +154,11 @@
 /******************************************************************************/
 #define  NO_ACTIVITED_INT							0 
 
+/**
+*@brief used to wrap the capture buffers indexes.
+*/
+#define  CAPTURE_MASK								(EXINT_CAPTURE_SIZE - 1)
+
 /******************************************************************************/
 
 
@@ -162,6 +168,35 @@
 /* PRIVATE MACROS */
 /******************************************************************************/
 
+/**
+*@brief check if the interrupt is enabled and captures the edges.
+*/
+#define  INT0_CAPTURE_USED			(INT0 == ENABLE && INT0_CAPTURE == ENABLE)
+#define  INT1_CAPTURE_USED			(INT1 == ENABLE && INT1_CAPTURE == ENABLE)
+#define  INT2_CAPTURE_USED			(INT2 == ENABLE && INT2_CAPTURE == ENABLE)
+#define  CAPTURE_USED				(INT0_CAPTURE_USED || INT1_CAPTURE_USED || INT2_CAPTURE_USED)
+
+#if CAPTURE_USED
+
+#if TIMER1_ENABLE == ON
+#error Timer1 is the timebase of the edge capture , TIMER1_ENABLE must be OFF.
+#endif
+
+#if (INT0_CAPTURE_USED && INT0_TYPE != FALLING_ADGE && INT0_TYPE != RAISING_ADGE) || \
+    (INT1_CAPTURE_USED && INT1_TYPE != FALLING_ADGE && INT1_TYPE != RAISING_ADGE)
+#error the interrupt type of the capture must be FALLING_ADGE or RAISING_ADGE.
+#endif
+
+#if EXINT_CAPTURE_SIZE < 2 || EXINT_CAPTURE_SIZE > 128 || (EXINT_CAPTURE_SIZE & (EXINT_CAPTURE_SIZE - 1)) != 0
+#error EXINT_CAPTURE_SIZE must be a power of two from 2 to 128.
+#endif
+
+#if ISR_TRACE == ISR_ON && ISR_TRACE_PRESCALER != EXINT_CAPTURE_PRESCALER
+#error the trace and the edge capture share Timer1 , they must use the same prescaler.
+#endif
+
+#endif
+
 
 /******************************************************************************/
 /* PRIVATE ENUMS */
@@ -183,6 +218,20 @@ typedef struct
 	void * vpFuncParam;
 } stIntCBCont_t;
 
+/**
+*@brief the capture state and the ring buffer of one interrupt.
+*/
+typedef struct
+{
+	EXINT_stPulse_t astPulses[EXINT_CAPTURE_SIZE];
+	volatile uint8_t u8Head;
+	volatile uint8_t u8Tail;
+	volatile boolean bOverrun;
+	uint16_t u16LastEdge;
+	boolean bStarted;
+	boolean bRising;
+} stCapture_t;
+
 
 /******************************************************************************/
 
@@ -201,6 +250,14 @@ typedef struct
 */
 static stIntCBCont_t astCallBacks[NUM_OF_ACT_INTS];
 
+#if CAPTURE_USED
+/**
+*@brief the captured durations of each interrupt , the ISR is the only producer
+*		and EXINT_enuReadPulse is the only consumer.
+*/
+static stCapture_t astCaptures[NUM_OF_ACT_INTS];
+#endif
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -218,23 +275,76 @@ static stIntCBCont_t astCallBacks[NUM_OF_ACT_INTS];
 /******************************************************************************/
 /* PRIVATE FUNCTION PROTOTYPES */
 /******************************************************************************/
+#if CAPTURE_USED
+/**
+*@brief saves the duration which ended with this edge , and returns TRUE if the
+*		edge was raising so the next edge is falling.
+*/
+static inline boolean bCaptureEdge(stCapture_t * ADD_pstCapture, uint16_t Copy_u16Now) __attribute__((always_inline));
+#endif
+
 #if INT0 == ENABLE
+/**
+*@brief the handler of External Interrupt Request 0.
+*/
+static void vINT0Handler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_INT0)
 void __vector_1(void) __attribute__((signal));
 #endif
+#endif
 
 #if INT1 == ENABLE
+/**
+*@brief the handler of External Interrupt Request 1.
+*/
+static void vINT1Handler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_INT1)
 void __vector_2(void) __attribute__((signal));
 #endif
+#endif
 
 #if INT2 == ENABLE
+/**
+*@brief the handler of External Interrupt Request 2.
+*/
+static void vINT2Handler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_INT2)
 void __vector_3(void) __attribute__((signal));
 #endif
+#endif
 
 /******************************************************************************/
 
 /******************************************************************************/
 /* PRIVATE FUNCTION DEFINITIONS */
 /******************************************************************************/
+
+#if CAPTURE_USED
+static inline boolean bCaptureEdge(stCapture_t * ADD_pstCapture, uint16_t Copy_u16Now)
+{
+	boolean LOC_bRising = ADD_pstCapture->bRising;
+	if(ADD_pstCapture->bStarted)
+	{
+		uint8_t LOC_u8Head = ADD_pstCapture->u8Head;
+		if((uint8_t)(LOC_u8Head - ADD_pstCapture->u8Tail) >= EXINT_CAPTURE_SIZE)
+		{
+			/*the buffer is full , this duration is lost*/
+			ADD_pstCapture->bOverrun = TRUE;
+		}
+		else
+		{
+			/*a raising edge ends a low duration*/
+			ADD_pstCapture->astPulses[LOC_u8Head & CAPTURE_MASK].u16Ticks = Copy_u16Now - ADD_pstCapture->u16LastEdge;
+			ADD_pstCapture->astPulses[LOC_u8Head & CAPTURE_MASK].enuLevel = LOC_bRising ? EXINT_enuLevelLow : EXINT_enuLevelHigh;
+			ADD_pstCapture->u8Head = LOC_u8Head + 1;
+		}
+	}
+	ADD_pstCapture->u16LastEdge = Copy_u16Now;
+	ADD_pstCapture->bStarted    = TRUE;
+	ADD_pstCapture->bRising     = !LOC_bRising;
+	return LOC_bRising;
+}
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
@@ -242,10 +352,24 @@ void __vector_3(void) __attribute__((signal));
 /******************************************************************************/
 void EXINT_init(void)
 {
+	#if CAPTURE_USED
+	TCCR1A = 0;									/*Timer1 in normal mode , it is never cleared*/
+	TCCR1B = EXINT_CAPTURE_PRESCALER;
+	#endif
+	#if INT0_CAPTURE_USED
+	astCaptures[EXINT_enuEXINT0].bRising = (INT0_TYPE == RAISING_ADGE);	/*the first sensed edge*/
+	#endif
+	#if INT1_CAPTURE_USED
+	astCaptures[EXINT_enuEXINT1].bRising = (INT1_TYPE == RAISING_ADGE);
+	#endif
+	#if INT2_CAPTURE_USED
+	astCaptures[EXINT_enuEXINT2].bRising = (INT2_TYPE == RAISING_ADGE);
+	#endif
 
-	SET_BIT(SREG,SERG_INT_EN_BIT);				/*Enable global interrupt by set 
-												Global Interrupt Enable in SREG */
 	#if INT0 == ENABLE							/*Check if the interrupt 0 enabled*/
+		#if ISR_IS_DISPATCHED(ISR_VECT_INT0)
+		ISR_enuAttach(ISR_VECT_INT0,vINT0Handler,NULL);	/*the dispatcher owns the vector*/
+		#endif
 		SET_BIT(GICR,GICR_EXT_0_INT_EN);		/*enabled external interrupt 0 */
 		uint8_t LOC_Int0Temp = 0;
 		#if INT0_TYPE == FALLING_ADGE			/*if interrupt occurring in falling edge*/
@@ -291,6 +415,9 @@ void EXINT_init(void)
 	#endif
 	
 	#if INT1 == ENABLE							/*Check if the interrupt 0 enabled*/
+		#if ISR_IS_DISPATCHED(ISR_VECT_INT1)
+		ISR_enuAttach(ISR_VECT_INT1,vINT1Handler,NULL);	/*the dispatcher owns the vector*/
+		#endif
 		SET_BIT(GICR,GICR_EXT_1_INT_EN);		/*enabled external interrupt 0 */
 		uint8_t LOC_Int1Temp = 0;
 		#if INT1_TYPE == FALLING_ADGE			/*if interrupt occurring in falling edge*/
@@ -336,6 +463,9 @@ void EXINT_init(void)
 	#endif
 	
 	#if INT2 == ENABLE							/*Check if the interrupt 0 enabled*/
+		#if ISR_IS_DISPATCHED(ISR_VECT_INT2)
+		ISR_enuAttach(ISR_VECT_INT2,vINT2Handler,NULL);	/*the dispatcher owns the vector*/
+		#endif
 		SET_BIT(GICR,GICR_EXT_2_INT_EN);		/*enabled external interrupt 0 */
 		uint8_t LOC_Int2Temp = 0;
 		#if INT2_TYPE == FALLING_ADGE			/*if interrupt occurring in falling edge*/
@@ -379,44 +509,168 @@ EXINT_enuError EXINT_enuSetCallBack(EXINT_enuInteruptsNames Copy_InterruptName,
 		/**
 		*@brief assign the  Call back and its params  for its interrupt.  
 		*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the ISR can't see half assigned call back*/
 		astCallBacks[Copy_InterruptName].ADD_CallBack = ADD_CallBack;
 		astCallBacks[Copy_InterruptName].vpFuncParam  = vpFuncParam;
+		CRITICAL_vExit(LOC_u8SREG);
 	}
 	return RET_enuErrorStatus;
 }
 
 #if INT0 == ENABLE
-void __vector_1(void)
+static void vINT0Handler(void * ADD_pvParam)
 {
-	if(astCallBacks[EXINT_enuEXINT0].ADD_CallBack != NULL)						/*if function not equal null execute*/
+	#if INT0_CAPTURE_USED
+	uint16_t LOC_u16Now = TCNT1;												/*the time of the edge , first thing in the ISR*/
+	if(bCaptureEdge(&astCaptures[EXINT_enuEXINT0],LOC_u16Now))
 	{
-		astCallBacks[EXINT_enuEXINT0].ADD_CallBack(astCallBacks[EXINT_enuEXINT0].vpFuncParam);
+		CLR_BIT(MCUCR,MCUCR_INT_SENSE_CTRL_00);										/*sense the falling edge next*/
 	}
-	SET_BIT(GIFR,INT0);															/*clear interrupt flag manually*/
+	else
+	{
+		SET_BIT(MCUCR,MCUCR_INT_SENSE_CTRL_00);										/*sense the raising edge next*/
+	}
+	#endif
+	ISR_vCallBack(astCallBacks[EXINT_enuEXINT0].ADD_CallBack,					/*call the user function or post it*/
+		      astCallBacks[EXINT_enuEXINT0].vpFuncParam);
+	#if !INT0_CAPTURE_USED
+	GIFR = (1 << INTF0);														/*clear interrupt flag manually , only this flag is written*/
+	#endif
 }
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_INT0)
+void __vector_1(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_INT0);
+	vINT0Handler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_INT0);
+}
+#endif
 #endif
 
 
 #if INT1 == ENABLE
-void __vector_2(void)
+static void vINT1Handler(void * ADD_pvParam)
 {
-	if(astCallBacks[EXINT_enuEXINT1].ADD_CallBack != NULL)						/*if function not equal null execute*/
+	#if INT1_CAPTURE_USED
+	uint16_t LOC_u16Now = TCNT1;												/*the time of the edge , first thing in the ISR*/
+	if(bCaptureEdge(&astCaptures[EXINT_enuEXINT1],LOC_u16Now))
 	{
-		astCallBacks[EXINT_enuEXINT1].ADD_CallBack(astCallBacks[EXINT_enuEXINT1].vpFuncParam);
+		CLR_BIT(MCUCR,MCUCR_INT_SENSE_CTRL_10);										/*sense the falling edge next*/
 	}
-	SET_BIT(GIFR,INT1);															/*clear interrupt flag manually*/
-}	
+	else
+	{
+		SET_BIT(MCUCR,MCUCR_INT_SENSE_CTRL_10);										/*sense the raising edge next*/
+	}
+	#endif
+	ISR_vCallBack(astCallBacks[EXINT_enuEXINT1].ADD_CallBack,					/*call the user function or post it*/
+		      astCallBacks[EXINT_enuEXINT1].vpFuncParam);
+	#if !INT1_CAPTURE_USED
+	GIFR = (1 << INTF1);														/*clear interrupt flag manually , only this flag is written*/
+	#endif
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_INT1)
+void __vector_2(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_INT1);
+	vINT1Handler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_INT1);
+}
+#endif
 #endif
 
 
 #if INT2 == ENABLE
-void __vector_3(void)
+static void vINT2Handler(void * ADD_pvParam)
 {
-	if(astCallBacks[EXINT_enuEXINT2].ADD_CallBack != NULL)						/*if function not equal null execute*/
+	#if INT2_CAPTURE_USED
+	uint16_t LOC_u16Now = TCNT1;												/*the time of the edge , first thing in the ISR*/
+	CLR_BIT(GICR,GICR_EXT_2_INT_EN);											/*changing ISC2 may set the flag , so INT2 is disabled first*/
+	if(bCaptureEdge(&astCaptures[EXINT_enuEXINT2],LOC_u16Now))
+	{
+		CLR_BIT(MCUCSR,MCUCSR_INT_SENSE_CNTL_2);									/*sense the falling edge next*/
+	}
+	else
 	{
-		astCallBacks[EXINT_enuEXINT2].ADD_CallBack(astCallBacks[EXINT_enuEXINT2].vpFuncParam);
+		SET_BIT(MCUCSR,MCUCSR_INT_SENSE_CNTL_2);									/*sense the raising edge next*/
 	}
-	SET_BIT(GIFR,INT2);								         	/*clear interrupt flag manually*/
+	GIFR = (1 << INTF2);														/*clear the false flag*/
+	SET_BIT(GICR,GICR_EXT_2_INT_EN);
+	#endif
+	ISR_vCallBack(astCallBacks[EXINT_enuEXINT2].ADD_CallBack,					/*call the user function or post it*/
+		      astCallBacks[EXINT_enuEXINT2].vpFuncParam);
+	#if !INT2_CAPTURE_USED
+	GIFR = (1 << INTF2);														/*clear interrupt flag manually , only this flag is written*/
+	#endif
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_INT2)
+void __vector_3(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_INT2);
+	vINT2Handler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_INT2);
 }
 #endif
-/******************************************************************************/
\ No newline at end of file
+#endif
+/******************************************************************************/
+
+
+EXINT_enuError EXINT_enuReadPulse(EXINT_enuInteruptsNames Copy_InterruptName, EXINT_stPulse_t * ADD_pstPulse)
+{
+	EXINT_enuError RET_enuErrorStatus = EXINT_enuOK;				/*return the status of function is working right or not */
+	if(Copy_InterruptName >= NUM_OF_ACT_INTS					/*Check inValid interrupt name*/
+	|| Copy_InterruptName < NO_ACTIVITED_INT)
+	{
+		RET_enuErrorStatus = EXINT_enuNotValidIntName;
+	}
+	else if(ADD_pstPulse == NULL)
+	{
+		RET_enuErrorStatus = EXINT_enuNullPtr;
+	}
+	#if CAPTURE_USED
+	else if(
+	#if INT0_CAPTURE_USED
+		Copy_InterruptName != EXINT_enuEXINT0 &&
+	#endif
+	#if INT1_CAPTURE_USED
+		Copy_InterruptName != EXINT_enuEXINT1 &&
+	#endif
+	#if INT2_CAPTURE_USED
+		Copy_InterruptName != EXINT_enuEXINT2 &&
+	#endif
+		TRUE)
+	{
+		RET_enuErrorStatus = EXINT_enuNotCapture;
+	}
+	else
+	{
+		stCapture_t * LOC_pstCapture = &astCaptures[Copy_InterruptName];
+		uint8_t LOC_u8Tail = LOC_pstCapture->u8Tail;
+		if(LOC_pstCapture->u8Head == LOC_u8Tail)
+		{
+			RET_enuErrorStatus = EXINT_enuEmpty;
+		}
+		else
+		{
+			/*the ISR never writes the entry at the tail , so it is read without critical section*/
+			*ADD_pstPulse = LOC_pstCapture->astPulses[LOC_u8Tail & CAPTURE_MASK];
+			LOC_pstCapture->u8Tail = LOC_u8Tail + 1;
+			uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*an overrun between the read and the clear is not lost*/
+			if(LOC_pstCapture->bOverrun)
+			{
+				LOC_pstCapture->bOverrun = FALSE;
+				RET_enuErrorStatus = EXINT_enuOverrun;
+			}
+			CRITICAL_vExit(LOC_u8SREG);
+		}
+	}
+	#else
+	else
+	{
+		RET_enuErrorStatus = EXINT_enuNotCapture;
+	}
+	#endif
+	return RET_enuErrorStatus;
+}
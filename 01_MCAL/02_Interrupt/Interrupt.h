@@ -90,8 +90,25 @@ typedef enum
 	/**
 	*@brief  returned if null pinter to function passed
 	*/
-	EXINT_enuNullPtr
-	
+	EXINT_enuNullPtr,
+
+	/**
+	*@brief returned if the interrupt is not configured to capture the edges.
+	*/
+	EXINT_enuNotCapture,
+
+	/**
+	*@brief returned if there is no captured duration.
+	*/
+	EXINT_enuEmpty,
+
+	/**
+	*@brief returned with a valid duration if some durations were lost because
+	*	the buffer was full , the durations around the lost ones are not
+	*	continuous.
+	*/
+	EXINT_enuOverrun
+
 } EXINT_enuError;
 
 
@@ -133,12 +150,38 @@ typedef enum
 	
 } EXINT_enuInteruptsNames;
 
+
+/**
+*@brief the level of the pin during the captured duration.
+*/
+typedef enum
+{
+	EXINT_enuLevelLow,
+	EXINT_enuLevelHigh
+} EXINT_enuLevel;
+
 /******************************************************************************/
 
 /******************************************************************************/
 /* PUBLIC TYPES */
 /******************************************************************************/
 
+/**
+*@brief one captured duration , the time between two edges.
+*/
+typedef struct
+{
+	/**
+	*@brief the duration in Timer1 ticks.
+	*/
+	uint16_t u16Ticks;
+
+	/**
+	*@brief the level of the pin during the duration.
+	*/
+	EXINT_enuLevel enuLevel;
+} EXINT_stPulse_t;
+
 /**
 * @brief		this function used to Set configuration for atmega32 interrupts.
 *
@@ -172,6 +215,28 @@ void EXINT_init(void);
 EXINT_enuError EXINT_enuSetCallBack(EXINT_enuInteruptsNames Copy_InterruptName, 
 								void (*ADD_CallBack)(void*),void * ADD_vpParam);
 
+
+
+/**
+* @brief							  this function used to read the oldest captured duration
+*									  of an interrupt configured with INTx_CAPTURE.
+*
+*
+* @param[in] Copy_InterruptName       Determines the name of the interrupt.
+*
+*
+* @param[out] ADD_pstPulse			 the duration and the level of the pin during it.
+*
+*
+* @return							 EXINT_enuEmpty if no duration is captured yet.
+*
+*
+* @note								the period is the sum of one high and one low duration ,
+*									the frequency is the Timer1 clock divided by the period.
+*/
+EXINT_enuError EXINT_enuReadPulse(EXINT_enuInteruptsNames Copy_InterruptName,
+								EXINT_stPulse_t * ADD_pstPulse);
+
 /******************************************************************************/
 
 /******************************************************************************/
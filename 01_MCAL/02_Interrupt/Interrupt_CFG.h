@@ -180,6 +180,41 @@ extern "C"
 
 
 
+/******************************************************************************/
+/*				 EDGE CAPTURE CONFIGURATION	              */
+/******************************************************************************/
+
+/**
+*@brief ENABLE to make the interrupt capture the time of each edge with the free
+*	running Timer1 and toggle its sense between the falling and the raising
+*	edge , the high and the low durations are read with EXINT_enuReadPulse.
+*	the interrupt type must be FALLING_ADGE or RAISING_ADGE , it is the first
+*	edge which is sensed.
+*/
+#define					INT0_CAPTURE				DISABLE
+#define					INT1_CAPTURE				DISABLE
+#define					INT2_CAPTURE				DISABLE
+
+/**
+*@brief the number of the durations which are kept for each interrupt , it must
+*	be a power of two.
+*/
+#define					EXINT_CAPTURE_SIZE			16
+
+/**
+*@brief the clock of Timer1 while capturing , the longest duration is 65535 ticks
+*	(with 8MHz EXINT_CAPTURE_CLK_64 gives 8us for each tick and 524ms at most).
+*/
+#define					EXINT_CAPTURE_CLK_1			1
+#define					EXINT_CAPTURE_CLK_8			2
+#define					EXINT_CAPTURE_CLK_64			3
+#define					EXINT_CAPTURE_CLK_256			4
+#define					EXINT_CAPTURE_CLK_1024			5
+
+#define					EXINT_CAPTURE_PRESCALER			EXINT_CAPTURE_CLK_64
+
+
+
 /******************************************************************************/
 
 
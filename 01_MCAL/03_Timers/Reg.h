@@ -85,7 +85,7 @@ extern "C"
 
 #define		OCR2			*((uint8_t*)0x43)
 
-#define		ASSR			*((uint8_t*)0x42)
+#define		ASSR			*((volatile uint8_t*)0x42)
 
 
 
@@ -94,6 +94,8 @@ extern "C"
 /************************************************************************/
 #define		TIMSK			*((uint8_t*)0x59)
 
+#define		TIFR			*((volatile uint8_t*)0x58)
+
 
 
 
@@ -27,17 +27,18 @@
 #include "Timer.h"
 #include "Reg.h"
 #include "Timers_CFG.h"
+#include "TimerSolver.h"
+#include "../02_Interrupt/ISR.h"
+#include "../02_Interrupt/Critical.h"
 /******************************************************************************/
 
 /******************************************************************************/
 /* PRIVATE DEFINES */
 /******************************************************************************/
 
-/* prescaler is 1024 to decrease interrupt jitter*/
-#define		 PRESCALER				1024
-
 /**
-*@brief this is the prescaler value to activate prescaler 1024
+*@brief this is the prescaler value to activate prescaler 1024 , prescaler is
+*	1024 to decrease interrupt jitter.
 */
 #define		 PRESCALER_VALUE			5
 
@@ -92,12 +93,6 @@
 */
 #define		OCIE1A					4
 
-/**
-*@brief   this refer to I bit in global interrupt.
-*/
-#define		SERG_INT_EN_BIT				7
-
-
 #define		WGM11					1
 
 
@@ -120,6 +115,30 @@
 /* Maximum value for 16-bit PWM */
 #define		PWM_MAX_VALUE				1023  
 
+/**
+*@brief the asynchronous status register bits of Timer2 , AS2 selects the
+*	crystal clock and the others are busy while a register is taken by it.
+*/
+#define		AS2					3
+#define		TCN2UB					2
+#define		OCR2UB					1
+#define		TCR2UB					0
+
+/**
+*@brief   Timer/Counter2 overflow and compare match flags.
+*/
+#define		TOV2					6
+#define		OCF2					7
+
+/**
+*@brief the prescaler 128 of Timer2 , 32768Hz / 128 / 256 is one overflow each second.
+*/
+#define		RTC_PRESCALER_VALUE			5
+
+#if TIMER2_RTC_ENABLE == ON && TIMER2_ENABLE != ON
+#error the RTC is Timer2 , TIMER2_ENABLE must be ON.
+#endif
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -128,11 +147,6 @@
 /* PRIVATE MACROS */
 /******************************************************************************/
 
-/**
-*@brief used to convert the micro-second to milli-second.
-*/
-#define		 SECONDTOMILLI(MICRO)			(MICRO * 1000)
-
 #if TIMER0_ENABLE == ON
 #define  MIN_TIMER Timer_enuTimer0
 #elif TIMER1_ENABLE == ON
@@ -209,14 +223,26 @@ typedef struct
 /******************************************************************************/
 
 /**
-*@brief this is the time which will take to increase the timer by 1 .
+*@brief this array contain the all information timer need .
+*/
+static stTimerInfo astTimersInfo[NUMBER_OF_ACTIVITED_TIMERS] = {0};
+
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+/**
+*@brief the calendar , it is moved one second by each overflow of Timer2.
 */
-static double TickTime =  0;
+static Timer_stDateTime_t stDateTime = {2000 , 1 , 1 , 0 , 0 , 0};
 
 /**
-*@brief this array contain the all information timer need .
+*@brief the seconds from the start of the RTC.
 */
-static stTimerInfo astTimersInfo[NUMBER_OF_ACTIVITED_TIMERS] = {0};
+static volatile uint32_t u32RTCSeconds = 0;
+
+/**
+*@brief the days of the months of a common year.
+*/
+static const uint8_t au8MonthDays[12] = {31 , 28 , 31 , 30 , 31 , 30 , 31 , 31 , 30 , 31 , 30 , 31};
+#endif
 
 /******************************************************************************/
 
@@ -237,45 +263,97 @@ static stTimerInfo astTimersInfo[NUMBER_OF_ACTIVITED_TIMERS] = {0};
 /******************************************************************************/
 #if TIMER0_ENABLE == ON
 /**
+* @brief Timer0 overflow handler , called from the vector or the dispatcher.
+*/
+static void vTimer0OvfHandler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
+/**
 * @brief Timer0 overflow interrupt service routine .
 */
 void __vector_11(void) __attribute__((signal));
+#endif
 
+/**
+* @brief timer0 compare handler , called from the vector or the dispatcher.
+*/
+static void vTimer0CompHandler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
 /**
 * @brief timer0 compare interrupt service routine;
 */
 void __vector_10(void) __attribute__((signal));
 #endif
+#endif
 
 #if TIMER2_ENABLE == ON
 /**
+* @brief Timer2 overflow handler , called from the vector or the dispatcher.
+*/
+static void vTimer2OvfHandler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER2_OVF)
+/**
 * @brief Timer2 overflow interrupt service routine .
 */
 void __vector_5(void) __attribute__((signal));
+#endif
 
+/**
+* @brief timer2 compare handler , called from the vector or the dispatcher.
+*/
+static void vTimer2CompHandler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER2_COMP)
 /**
 * @brief timer2 compare interrupt service routine;
 */
 void __vector_4(void) __attribute__((signal));
 #endif
+#endif
 
 #if TIMER1_ENABLE == ON
 
+/**
+* @brief Timer1 overflow handler , called from the vector or the dispatcher.
+*/
+static void vTimer1OvfHandler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
 /**
 * @brief Timer1 overflow interrupt service routine.
 */
 void __vector_9(void) __attribute__((signal));
+#endif
 
+/**
+* @brief timer1 compare handler , called from the vector or the dispatcher.
+*/
+static void vTimer1CompHandler(void * ADD_pvParam);
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
 /**
 * @brief timer1 compare interrupt service routine.
 */
 void __vector_7(void) __attribute__((signal));
 #endif
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
 /* PRIVATE FUNCTION DEFINITIONS */
 /******************************************************************************/
+
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+/**
+* @brief the days of the month , every fourth year is leap from 2000 to 2099.
+*/
+static uint8_t u8DaysOfMonth(uint16_t Copy_u16Year, uint8_t Copy_u8Month)
+{
+	uint8_t RET_u8Days = au8MonthDays[Copy_u8Month - 1];
+	if(Copy_u8Month == 2 && (Copy_u16Year % 4) == 0)
+	{
+		RET_u8Days++;
+	}
+	return RET_u8Days;
+}
+#endif
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -290,11 +368,26 @@ void Timer_vInit()
 	#if F_CPU == 0
 		#error "F_CPU Can't be zero." 
 	#endif 	
-	/*calculate the time of tick in milli-seconds */
-	TickTime = SECONDTOMILLI(((double)PRESCALER / F_CPU)) ;
 
-	/*Enable global interrupt by set */
-	SET_BIT(SREG,SERG_INT_EN_BIT);				
+	/*attach the handlers of the dispatched vectors*/
+	#if TIMER0_ENABLE == ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
+	ISR_enuAttach(ISR_VECT_TIMER0_OVF,vTimer0OvfHandler,NULL);
+	#endif
+	#if TIMER0_ENABLE == ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
+	ISR_enuAttach(ISR_VECT_TIMER0_COMP,vTimer0CompHandler,NULL);
+	#endif
+	#if TIMER1_ENABLE == ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
+	ISR_enuAttach(ISR_VECT_TIMER1_OVF,vTimer1OvfHandler,NULL);
+	#endif
+	#if TIMER1_ENABLE == ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
+	ISR_enuAttach(ISR_VECT_TIMER1_COMPA,vTimer1CompHandler,NULL);
+	#endif
+	#if TIMER2_ENABLE == ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER2_OVF)
+	ISR_enuAttach(ISR_VECT_TIMER2_OVF,vTimer2OvfHandler,NULL);
+	#endif
+	#if TIMER2_ENABLE == ON && ISR_IS_DISPATCHED(ISR_VECT_TIMER2_COMP)
+	ISR_enuAttach(ISR_VECT_TIMER2_COMP,vTimer2CompHandler,NULL);
+	#endif
 }
 
 
@@ -321,8 +414,39 @@ Timer_enuErrors_t Timer_enuSetTime(Timer_enuType_t Copy_enuTimerName,
 	{
 		RET_enuErrorStatus = Timer_enuInvalidTimerInterval;
 	}
+	#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+	/*Timer2 is the RTC , it is clocked from the crystal*/
+	else if(Copy_enuTimerName == Timer_enuTimer2)
+	{
+		RET_enuErrorStatus = Timer_enuInvalidMode;
+	}
+	#endif
 	else
 	{
+		/*the solver of the timer , the prescaler is fixed to 1024 to decrease interrupt jitter*/
+		TSOLV_enuTimer_t LOC_enuSolverTimer = TSOLV_enuTimer0;
+		uint8_t LOC_u8Prescaler = PRESCALER_VALUE;
+		#if TIMER1_ENABLE == ON
+		if(Copy_enuTimerName == Timer_enuTimer1)
+		{
+			LOC_enuSolverTimer = TSOLV_enuTimer1;
+		}
+		#endif
+		#if TIMER2_ENABLE == ON
+		if(Copy_enuTimerName == Timer_enuTimer2)
+		{
+			LOC_enuSolverTimer = TSOLV_enuTimer2;
+			LOC_u8Prescaler    = PRESCALER_VALUE_TIMER_2;
+		}
+		#endif
+
+		/*solved before the critical section , the interrupts are not delayed by the math*/
+		TSOLV_stSolution_t LOC_stSolution;
+		TSOLV_enuSolve(LOC_enuSolverTimer,LOC_u8Prescaler,F_CPU,(uint32_t)Copy_enuTime * 25,&LOC_stSolution);
+
+		/*the ISR of the timer reads the tick count and the preload , and the 16 bit registers share one temp register*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		astTimersInfo[Copy_enuTimerName].u8CurrentTicksCount = 0;
 
 		switch(Copy_enuTimerName)
 		{
@@ -335,21 +459,9 @@ Timer_enuErrors_t Timer_enuSetTime(Timer_enuType_t Copy_enuTimerName,
 				     case CTC:
 				     /*it enable the output compare interrupt for timer 0*/
 				     	SET_BIT(TIMSK, OCIE0);
-					/*calculate the number of ticks need to achive the time needed*/
-				        uint16_t NumberOfTick = ((Copy_enuTime * 25) / TickTime);
-					/*This loop used for found number be divisible with the number of thicks*/
-				        boolean NotFactor = TRUE;
-				        for(uint8_t u32factor = TIMER0_SIZE -1 ; NotFactor ;u32factor--)
-				        {
-					        if(NumberOfTick % u32factor == 0)
-					        {
-						      OCR0 =  astTimersInfo[Copy_enuTimerName].u8Preload = u32factor;
-						        NotFactor = FALSE;
-					        }
-				        }
-					/*calculate how many numbers of interrupts need to execute the user function*/
-					astTimersInfo[Copy_enuTimerName].u8TickCount = ((Copy_enuTime * 25) / TickTime) 
-											/astTimersInfo[Copy_enuTimerName].u8Preload ;
+					/*the timer is cleared after (OCR0 + 1) ticks , the callback after u32Count interrupts*/
+					OCR0 = astTimersInfo[Copy_enuTimerName].u8Preload = LOC_stSolution.u16Compare;
+					astTimersInfo[Copy_enuTimerName].u8TickCount = LOC_stSolution.u32Count;
 					/*Enable the timer and put the prescaler as 1024*/
 					SET_BIT_FIELD(TCCR0,PRESCALER_VALUE | CTC0,0);
 				     break;
@@ -358,16 +470,10 @@ Timer_enuErrors_t Timer_enuSetTime(Timer_enuType_t Copy_enuTimerName,
 				     /*Enable the Timer0 overflow interrupt which in TIWSK register */
 					SET_BIT(TIMSK, TOIE0);
 
-					/*calculate the number of ticks need to execute the user function*/
-					astTimersInfo[Copy_enuTimerName].u8TickCount = ((Copy_enuTime * 25) / TickTime) / TIMER0_SIZE;
-
-					/*this is to calculate the preload (initial value for the counter). */
-					 TCNT0 = astTimersInfo[Copy_enuTimerName].u8Preload =
-						TIMER0_SIZE - ((uint16_t)((Copy_enuTime * 25) / TickTime) % TIMER0_SIZE);
-
-					/*if the preload not equal to zero that mean we have reminder so tick added by one*/
-						astTimersInfo[Copy_enuTimerName].u8TickCount +=
-						(astTimersInfo[Copy_enuTimerName].u8Preload > 0)?1:0;
+					/*the overflows which cover the ticks , the first one is shortened by the preload*/
+					astTimersInfo[Copy_enuTimerName].u8TickCount = (LOC_stSolution.u32Ticks + TIMER0_SIZE - 1) / TIMER0_SIZE;
+					TCNT0 = astTimersInfo[Copy_enuTimerName].u8Preload =
+						(astTimersInfo[Copy_enuTimerName].u8TickCount * TIMER0_SIZE) - LOC_stSolution.u32Ticks;
 				     		SET_BIT_FIELD(TCCR0,PRESCALER_VALUE,0);
 
 				     break;
@@ -381,23 +487,17 @@ Timer_enuErrors_t Timer_enuSetTime(Timer_enuType_t Copy_enuTimerName,
 				{
 					case CTC:
 					     SET_BIT(TIMSK, OCIE1A);
-					     uint16_t NumberOfTick = ((Copy_enuTime * 25) / TickTime);
-					     boolean NotFactor = TRUE;
-					     OCR1A =  astTimersInfo[Copy_enuTimerName].u8Preload = NumberOfTick;
-					     astTimersInfo[Copy_enuTimerName].u8TickCount = ((Copy_enuTime * 25) / TickTime)
-					     /astTimersInfo[Copy_enuTimerName].u8Preload ;
+					     OCR1A = astTimersInfo[Copy_enuTimerName].u8Preload = LOC_stSolution.u16Compare;
+					     astTimersInfo[Copy_enuTimerName].u8TickCount = LOC_stSolution.u32Count;
 					     SET_BIT_FIELD(TCCR1B,PRESCALER_VALUE | CTC0,0);
 					break;
 
 					case Normal:
 						SET_BIT(TIMSK, TOIE1);
 						SET_BIT_FIELD(TCCR1B,PRESCALER_VALUE,0);
-						astTimersInfo[Copy_enuTimerName].u8TickCount = 
-						 ((Copy_enuTime * 25) / TickTime) / TIMER1_SIZE;
+						astTimersInfo[Copy_enuTimerName].u8TickCount = (LOC_stSolution.u32Ticks + TIMER1_SIZE - 1) / TIMER1_SIZE;
 						TCNT1 = astTimersInfo[Copy_enuTimerName].u8Preload =
-						TIMER1_SIZE - ((uint16_t)((Copy_enuTime * 25) / TickTime) % TIMER1_SIZE);
-							astTimersInfo[Copy_enuTimerName].u8TickCount +=
-							(astTimersInfo[Copy_enuTimerName].u8Preload > 0)?1:0;
+							(astTimersInfo[Copy_enuTimerName].u8TickCount * TIMER1_SIZE) - LOC_stSolution.u32Ticks;
 						break;
 				}
 
@@ -409,29 +509,17 @@ Timer_enuErrors_t Timer_enuSetTime(Timer_enuType_t Copy_enuTimerName,
 				{
 					case CTC:
 					SET_BIT(TIMSK, OCIE2);
-					uint16_t NumberOfTick = ((Copy_enuTime * 25) / TickTime);
-					boolean NotFactor = TRUE;
-
-					for (uint16_t u32factor = TIMER0_SIZE - 1; NotFactor && u32factor > 1; u32factor--) {
-						if (NumberOfTick % u32factor == 0) {
-							OCR2 = astTimersInfo[Timer_enuTimer2].u8Preload = u32factor;
-							NotFactor = FALSE;
-						}
-					}
-
-					astTimersInfo[Timer_enuTimer2].u8TickCount = ((Copy_enuTime * 25) / TickTime) / astTimersInfo[Timer_enuTimer2].u8Preload;
+					OCR2 = astTimersInfo[Timer_enuTimer2].u8Preload = LOC_stSolution.u16Compare;
+					astTimersInfo[Timer_enuTimer2].u8TickCount = LOC_stSolution.u32Count;
 
 					SET_BIT_FIELD(TCCR2, PRESCALER_VALUE_TIMER_2 | CTC0, 0);
 					break;
 
 					case Normal:
 					SET_BIT(TIMSK, TOIE2);
-					astTimersInfo[Copy_enuTimerName].u8TickCount =
-					((Copy_enuTime * 25) / TickTime) / TIMER0_SIZE;
+					astTimersInfo[Copy_enuTimerName].u8TickCount = (LOC_stSolution.u32Ticks + TIMER0_SIZE - 1) / TIMER0_SIZE;
 					TCNT2 = astTimersInfo[Copy_enuTimerName].u8Preload =
-					TIMER0_SIZE - ((uint16_t)((Copy_enuTime * 25) / TickTime) % TIMER0_SIZE);
-					astTimersInfo[Copy_enuTimerName].u8TickCount +=
-					(astTimersInfo[Copy_enuTimerName].u8Preload > 0)?1:0;
+						(astTimersInfo[Copy_enuTimerName].u8TickCount * TIMER0_SIZE) - LOC_stSolution.u32Ticks;
 					SET_BIT_FIELD(TCCR2,PRESCALER_VALUE_TIMER_2,0);
 					break;
 				}
@@ -439,6 +527,8 @@ Timer_enuErrors_t Timer_enuSetTime(Timer_enuType_t Copy_enuTimerName,
 			break;
 			#endif
 		} 
+
+		CRITICAL_vExit(LOC_u8SREG);
 	}
 	return RET_enuErrorStatus;
 }
@@ -463,8 +553,10 @@ Timer_enuErrors_t Timer_enuSetCallBack(Timer_enuType_t Copy_enuTimerName, void (
 		/**
 		*@brief assign the  Call back and its params  for its interrupt.  
 		*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
 		astTimersInfo[Copy_enuTimerName].ADD_CallBack = ADD_CallBack;
 		astTimersInfo[Copy_enuTimerName].vpFuncParam  = ADD_vpFuncParam;
+		CRITICAL_vExit(LOC_u8SREG);
 	}
 	return RET_enuErrorStatus;
 }
@@ -488,16 +580,119 @@ void Timer_enuPWM(uint8_t u8DutyCycle)
 	* This is the value which is put in output compare match
 	* to generate the duty cycle.
 	*/
-	uint16_t u16OCR_Value = PWM_MAX_VALUE * (u8DutyCycle / (float)100);
+	uint16_t u16OCR_Value = ((uint32_t)PWM_MAX_VALUE * u8DutyCycle) / 100;
 	OCR1A =     u16OCR_Value;
 
 	/*Put the prescaler and enable the timer to work*/
 	SET_BIT_FIELD(TCCR1B,PRESCALER_VALUE,0);
 }
 #endif 
+
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+Timer_enuErrors_t Timer_enuStartRTC(void)
+{
+	/*return the status of function is working right or not */
+	Timer_enuErrors_t RET_enuErrorStatus = Timer_enuOk;
+
+	/*the interrupts of Timer2 are disabled while its clock is changed*/
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	CLR_BIT(TIMSK, TOIE2);
+	CLR_BIT(TIMSK, OCIE2);
+	SET_BIT(ASSR, AS2);
+	TCNT2 = 0;
+	OCR2  = 0;
+	TCCR2 = RTC_PRESCALER_VALUE;
+	CRITICAL_vExit(LOC_u8SREG);
+
+	/*the registers are taken after two crystal cycles , about 61us*/
+	while(ASSR & ((1 << TCN2UB) | (1 << OCR2UB) | (1 << TCR2UB)));
+
+	LOC_u8SREG = CRITICAL_u8Enter();
+	u32RTCSeconds = 0;
+	TIFR = (1 << TOV2) | (1 << OCF2);						/*the clock change may set the flags , clear them by writing one*/
+	SET_BIT(TIMSK, TOIE2);
+	CRITICAL_vExit(LOC_u8SREG);
+
+	return RET_enuErrorStatus;
+}
+
+
+Timer_enuErrors_t Timer_enuSetDateTime(const Timer_stDateTime_t * ADD_pstDateTime)
+{
+	/*return the status of function is working right or not */
+	Timer_enuErrors_t RET_enuErrorStatus = Timer_enuOk;
+
+	if(ADD_pstDateTime == NULL)
+	{
+		RET_enuErrorStatus = Timer_enuNullPtr;
+	}
+	else if(ADD_pstDateTime->u16Year < 2000 || ADD_pstDateTime->u16Year > 2099 ||
+		ADD_pstDateTime->u8Month < 1 || ADD_pstDateTime->u8Month > 12 ||
+		ADD_pstDateTime->u8Day < 1 || ADD_pstDateTime->u8Day > u8DaysOfMonth(ADD_pstDateTime->u16Year,ADD_pstDateTime->u8Month) ||
+		ADD_pstDateTime->u8Hour > 23 || ADD_pstDateTime->u8Minute > 59 || ADD_pstDateTime->u8Second > 59)
+	{
+		RET_enuErrorStatus = Timer_enuInvalidDateTime;
+	}
+	else
+	{
+		/*the overflow moves the calendar*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		stDateTime = *ADD_pstDateTime;
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+	return RET_enuErrorStatus;
+}
+
+
+Timer_enuErrors_t Timer_enuGetDateTime(Timer_stDateTime_t * ADD_pstDateTime)
+{
+	/*return the status of function is working right or not */
+	Timer_enuErrors_t RET_enuErrorStatus = Timer_enuOk;
+
+	if(ADD_pstDateTime == NULL)
+	{
+		RET_enuErrorStatus = Timer_enuNullPtr;
+	}
+	else
+	{
+		/*the overflow moves the calendar*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		*ADD_pstDateTime = stDateTime;
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+	return RET_enuErrorStatus;
+}
+
+
+uint32_t Timer_u32GetRTCSeconds(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	uint32_t LOC_u32Seconds = u32RTCSeconds;
+	CRITICAL_vExit(LOC_u8SREG);
+	return LOC_u32Seconds;
+}
+
+
+void Timer_vSyncRTC(void)
+{
+	/*a write to OCR2 is busy until the next crystal cycle , then the wake up logic is ready*/
+	OCR2 = 0;
+	while(ASSR & (1 << OCR2UB));
+}
+#endif
+
 #if TIMER0_ENABLE == ON
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
 void __vector_11(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER0_OVF);
+	vTimer0OvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER0_OVF);
+}
+#endif
+
+static void vTimer0OvfHandler(void * ADD_pvParam)
 {
 	/*the current number of counts */
 	uint32_t u8currentTicks =
@@ -516,15 +711,7 @@ void __vector_11(void)
 		astTimersInfo[Timer_enuTimer0].u8CurrentTicksCount = 0;
 
 		/*if the callback function is not equal to null execute it*/
-		if(astTimersInfo[Timer_enuTimer0].ADD_CallBack != NULL)
-		{
-			astTimersInfo[Timer_enuTimer0].ADD_CallBack(
-				astTimersInfo[Timer_enuTimer0].vpFuncParam);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		ISR_vCallBack(astTimersInfo[Timer_enuTimer0].ADD_CallBack,astTimersInfo[Timer_enuTimer0].vpFuncParam);
 	}
 	else
 	{
@@ -534,7 +721,16 @@ void __vector_11(void)
 
 
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
 void __vector_10(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER0_COMP);
+	vTimer0CompHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER0_COMP);
+}
+#endif
+
+static void vTimer0CompHandler(void * ADD_pvParam)
 {
 	uint32_t u8currentTicks =
 	++astTimersInfo[Timer_enuTimer0].u8CurrentTicksCount;
@@ -542,15 +738,7 @@ void __vector_10(void)
 	if(u8currentTicks == u8TargetTicks)
 	{
 		astTimersInfo[Timer_enuTimer0].u8CurrentTicksCount = 0;
-		if(astTimersInfo[Timer_enuTimer0].ADD_CallBack != NULL)
-		{
-			astTimersInfo[Timer_enuTimer0].ADD_CallBack(
-			astTimersInfo[Timer_enuTimer0].vpFuncParam);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		ISR_vCallBack(astTimersInfo[Timer_enuTimer0].ADD_CallBack,astTimersInfo[Timer_enuTimer0].vpFuncParam);
 	}
 	else
 	{
@@ -563,8 +751,43 @@ void __vector_10(void)
 
 #if TIMER2_ENABLE == ON
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER2_OVF)
 void __vector_5(void)
 {
+	ISR_TRACE_ENTER(ISR_VECT_TIMER2_OVF);
+	vTimer2OvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER2_OVF);
+}
+#endif
+
+static void vTimer2OvfHandler(void * ADD_pvParam)
+{
+	#if TIMER2_RTC_ENABLE == ON
+	/*one second , the carries are rare so it is short*/
+	u32RTCSeconds++;
+	if(++stDateTime.u8Second > 59)
+	{
+		stDateTime.u8Second = 0;
+		if(++stDateTime.u8Minute > 59)
+		{
+			stDateTime.u8Minute = 0;
+			if(++stDateTime.u8Hour > 23)
+			{
+				stDateTime.u8Hour = 0;
+				if(++stDateTime.u8Day > u8DaysOfMonth(stDateTime.u16Year,stDateTime.u8Month))
+				{
+					stDateTime.u8Day = 1;
+					if(++stDateTime.u8Month > 12)
+					{
+						stDateTime.u8Month = 1;
+						stDateTime.u16Year++;
+					}
+				}
+			}
+		}
+	}
+	ISR_vCallBack(astTimersInfo[Timer_enuTimer2].ADD_CallBack,astTimersInfo[Timer_enuTimer2].vpFuncParam);
+	#else
 	uint32_t u8currentTicks =
 	++astTimersInfo[Timer_enuTimer2].u8CurrentTicksCount;
 	uint32_t u8TargetTicks  = astTimersInfo[Timer_enuTimer2].u8TickCount;
@@ -572,33 +795,33 @@ void __vector_5(void)
 	{
 		TCNT2 = astTimersInfo[Timer_enuTimer2].u8Preload;
 		astTimersInfo[Timer_enuTimer2].u8CurrentTicksCount = 0;
-		if(astTimersInfo[Timer_enuTimer2].ADD_CallBack != NULL)
-		{
-			astTimersInfo[Timer_enuTimer2].ADD_CallBack(
-			astTimersInfo[Timer_enuTimer2].vpFuncParam);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		ISR_vCallBack(astTimersInfo[Timer_enuTimer2].ADD_CallBack,astTimersInfo[Timer_enuTimer2].vpFuncParam);
 	}
 	else
 	{
 		/*No thing*/
 	}
+	#endif
 }
 
-void __vector_4(void) {
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER2_COMP)
+void __vector_4(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER2_COMP);
+	vTimer2CompHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER2_COMP);
+}
+#endif
+
+static void vTimer2CompHandler(void * ADD_pvParam)
+{
 	uint32_t u8currentTicks = ++astTimersInfo[Timer_enuTimer2].u8CurrentTicksCount;
 	uint32_t u8TargetTicks = astTimersInfo[Timer_enuTimer2].u8TickCount;
 
 	if (u8currentTicks == u8TargetTicks) {
 		astTimersInfo[Timer_enuTimer2].u8CurrentTicksCount = 0;
 
-		if (astTimersInfo[Timer_enuTimer2].ADD_CallBack != NULL) {
-			astTimersInfo[Timer_enuTimer2].ADD_CallBack(astTimersInfo[Timer_enuTimer2].vpFuncParam);
-		}
-		// else: Do nothing if callback is not set
+		ISR_vCallBack(astTimersInfo[Timer_enuTimer2].ADD_CallBack,astTimersInfo[Timer_enuTimer2].vpFuncParam);
 	}
 	// else: Do nothing if target ticks not reached
 }
@@ -607,7 +830,16 @@ void __vector_4(void) {
 #endif
 
 #if TIMER1_ENABLE == ON
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
 void __vector_9(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_OVF);
+	vTimer1OvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_OVF);
+}
+#endif
+
+static void vTimer1OvfHandler(void * ADD_pvParam)
 {
 	uint32_t u8currentTicks =
 	++astTimersInfo[Timer_enuTimer1].u8CurrentTicksCount;
@@ -616,16 +848,7 @@ void __vector_9(void)
 	{
 		TCNT1 = astTimersInfo[Timer_enuTimer1].u8Preload;
 		astTimersInfo[Timer_enuTimer1].u8CurrentTicksCount = 0;
-		if(astTimersInfo[Timer_enuTimer1].ADD_CallBack != NULL)
-		{
-			astTimersInfo[Timer_enuTimer1].ADD_CallBack(
-				
-				astTimersInfo[Timer_enuTimer1].vpFuncParam);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		ISR_vCallBack(astTimersInfo[Timer_enuTimer1].ADD_CallBack,astTimersInfo[Timer_enuTimer1].vpFuncParam);
 	}
 	else
 	{
@@ -634,7 +857,16 @@ void __vector_9(void)
 }
 
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
 void __vector_7(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_COMPA);
+	vTimer1CompHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_COMPA);
+}
+#endif
+
+static void vTimer1CompHandler(void * ADD_pvParam)
 {
 	uint32_t u8currentTicks =
 	++astTimersInfo[Timer_enuTimer1].u8CurrentTicksCount;
@@ -642,15 +874,7 @@ void __vector_7(void)
 	if(u8currentTicks == u8TargetTicks)
 	{
 		astTimersInfo[Timer_enuTimer1].u8CurrentTicksCount = 0;
-		if(astTimersInfo[Timer_enuTimer1].ADD_CallBack != NULL)
-		{
-			astTimersInfo[Timer_enuTimer1].ADD_CallBack(
-			astTimersInfo[Timer_enuTimer1].vpFuncParam);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		ISR_vCallBack(astTimersInfo[Timer_enuTimer1].ADD_CallBack,astTimersInfo[Timer_enuTimer1].vpFuncParam);
 	}
 	else
 	{
@@ -123,7 +123,12 @@ typedef enum
 	/**
 	*@brief  returned if null pinter to function passed
 	*/
-	Timer_enuNullPtr
+	Timer_enuNullPtr ,
+
+	/**
+	*@brief  returned if the date or the time is out of its range.
+	*/
+	Timer_enuInvalidDateTime
 } Timer_enuErrors_t;
 
 
@@ -206,6 +211,36 @@ typedef enum
 /* PUBLIC TYPES */
 /******************************************************************************/
 
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+/**
+*@brief the date and the time of the Timer2 calendar.
+*/
+typedef struct
+{
+	/**
+	*@brief from 2000 to 2099.
+	*/
+	uint16_t u16Year;
+
+	/**
+	*@brief from 1 to 12.
+	*/
+	uint8_t u8Month;
+
+	/**
+	*@brief from 1 to the days of the month.
+	*/
+	uint8_t u8Day;
+
+	uint8_t u8Hour;
+
+	uint8_t u8Minute;
+
+	uint8_t u8Second;
+
+} Timer_stDateTime_t;
+#endif
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -303,6 +338,54 @@ Timer_enuErrors_t Timer_enuSetCallBack(Timer_enuType_t Copy_enuTimerName,
 void Timer_enuPWM(uint8_t u8DutyCycle);
 #endif
 
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+/**
+* @brief			  starts Timer2 in the asynchronous mode from the
+*				  watch crystal , its overflow is each second.
+*
+*@return Timer error status
+*
+*@note				  the crystal needs about one second to be stable
+*				  after the power on. the callback of Timer2 is
+*				  called each second , Timer_enuSetTime can't be
+*				  used with Timer2 in this mode.
+*/
+Timer_enuErrors_t Timer_enuStartRTC(void);
+
+/**
+* @brief			  sets the date and the time of the calendar ,
+*				  the fraction of the current second is not cleared.
+*
+* @param[in]	ADD_pstDateTime	  the new date and time.
+*
+*@return Timer error status
+*/
+Timer_enuErrors_t Timer_enuSetDateTime(const Timer_stDateTime_t * ADD_pstDateTime);
+
+/**
+* @brief			  gets the date and the time of the calendar.
+*
+* @param[out]	ADD_pstDateTime	  the current date and time.
+*
+*@return Timer error status
+*/
+Timer_enuErrors_t Timer_enuGetDateTime(Timer_stDateTime_t * ADD_pstDateTime);
+
+/**
+* @brief			  gets the seconds from Timer_enuStartRTC , it is
+*				  not changed by Timer_enuSetDateTime.
+*/
+uint32_t Timer_u32GetRTCSeconds(void);
+
+/**
+* @brief			  waits the asynchronous registers of Timer2 to be
+*				  updated , it is called before the power-save sleep
+*				  because the CPU wakes up early if it sleeps before
+*				  the registers are taken by the crystal clock.
+*/
+void Timer_vSyncRTC(void);
+#endif
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -0,0 +1,211 @@
+/******************************************************************************/
+/**
+ * @file TimerSolver.c
+ * @brief timers period solver with integer math only.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the period is changed to CPU cycles once , then for each prescaler the
+ * cycles are divided to ticks by a shift (all the prescalers are powers of
+ * two). the interrupts are the fewest which cover the ticks and the compare
+ * value is the rounded division of the ticks on them , so the error of each
+ * prescaler is half a tick for each interrupt at most.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "TimerSolver.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the number of the clock select values of each timer.
+*/
+#define		TIMER0_PRESCALERS			5
+#define		TIMER2_PRESCALERS			7
+
+/**
+*@brief the shift of the size of the 8-bit and 16-bit timers.
+*/
+#define		SIZE_SHIFT_8BIT				8
+#define		SIZE_SHIFT_16BIT			16
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the shift of the division of each clock select value , index 0 is
+*	clock select 1.
+*/
+static const uint8_t au8Timer0Shifts[TIMER0_PRESCALERS] = {0 , 3 , 6 , 8 , 10};
+static const uint8_t au8Timer2Shifts[TIMER2_PRESCALERS] = {0 , 3 , 5 , 6 , 7 , 8 , 10};
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief solves the period for one prescaler.
+*/
+static void vSolveOne(uint32_t Copy_u32Cycles, uint8_t Copy_u8Shift, uint8_t Copy_u8SizeShift,
+		      TSOLV_stSolution_t * ADD_pstSolution);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static void vSolveOne(uint32_t Copy_u32Cycles, uint8_t Copy_u8Shift, uint8_t Copy_u8SizeShift,
+		      TSOLV_stSolution_t * ADD_pstSolution)
+{
+	uint32_t LOC_u32Ticks = Copy_u32Cycles >> Copy_u8Shift;
+	if(Copy_u8Shift > 0)
+	{
+		/*rounded , the last bit shifted out is the half*/
+		LOC_u32Ticks += (Copy_u32Cycles >> (Copy_u8Shift - 1)) & 1;
+	}
+	if(LOC_u32Ticks == 0)
+	{
+		LOC_u32Ticks = 1;
+	}
+
+	/*the fewest interrupts , the ticks of each one fit in the timer*/
+	uint32_t LOC_u32Count = (LOC_u32Ticks + ((uint32_t)1 << Copy_u8SizeShift) - 1) >> Copy_u8SizeShift;
+	uint32_t LOC_u32Top   = LOC_u32Ticks;
+	if(LOC_u32Count > 1)
+	{
+		LOC_u32Top = (LOC_u32Ticks + (LOC_u32Count >> 1)) / LOC_u32Count;
+	}
+
+	ADD_pstSolution->u16Compare = (uint16_t)(LOC_u32Top - 1);
+	ADD_pstSolution->u32Count   = LOC_u32Count;
+	ADD_pstSolution->u32Ticks   = LOC_u32Top * LOC_u32Count;
+	/*the difference is small , the wrap of the unsigned subtraction gives its sign*/
+	ADD_pstSolution->s32Error   = (sint32_t)((ADD_pstSolution->u32Ticks << Copy_u8Shift) - Copy_u32Cycles);
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+TSOLV_enuErrors_t TSOLV_enuSolve(TSOLV_enuTimer_t Copy_enuTimer, uint8_t Copy_u8Prescaler, uint32_t Copy_u32ClockHz,
+				 uint32_t Copy_u32PeriodMS, TSOLV_stSolution_t * ADD_pstSolution)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	TSOLV_enuErrors_t RET_enuErrorStatus = TSOLV_enuOK;
+
+	const uint8_t * LOC_pu8Shifts = (Copy_enuTimer == TSOLV_enuTimer2) ? au8Timer2Shifts : au8Timer0Shifts;
+	uint8_t LOC_u8Prescalers      = (Copy_enuTimer == TSOLV_enuTimer2) ? TIMER2_PRESCALERS : TIMER0_PRESCALERS;
+	uint8_t LOC_u8SizeShift       = (Copy_enuTimer == TSOLV_enuTimer1) ? SIZE_SHIFT_16BIT : SIZE_SHIFT_8BIT;
+	uint32_t LOC_u32KiloHz        = Copy_u32ClockHz / 1000UL;
+
+	if(Copy_enuTimer != TSOLV_enuTimer0 && Copy_enuTimer != TSOLV_enuTimer1 && Copy_enuTimer != TSOLV_enuTimer2)
+	{
+		RET_enuErrorStatus = TSOLV_enuInvalidTimer;
+	}
+	else if(Copy_u8Prescaler > LOC_u8Prescalers)
+	{
+		RET_enuErrorStatus = TSOLV_enuInvalidPrescaler;
+	}
+	else if(Copy_u32PeriodMS == 0 || Copy_u32PeriodMS > (0xFFFFFFFFUL / (LOC_u32KiloHz + 1)))
+	{
+		RET_enuErrorStatus = TSOLV_enuInvalidPeriod;
+	}
+	else if(ADD_pstSolution == NULL)
+	{
+		RET_enuErrorStatus = TSOLV_enuNullPtr;
+	}
+	else
+	{
+		uint32_t LOC_u32Cycles = (Copy_u32PeriodMS * LOC_u32KiloHz) +
+					 ((Copy_u32PeriodMS * (Copy_u32ClockHz % 1000UL)) / 1000UL);
+
+		if(Copy_u8Prescaler != TSOLV_ANY_PRESCALER)
+		{
+			vSolveOne(LOC_u32Cycles,LOC_pu8Shifts[Copy_u8Prescaler - 1],LOC_u8SizeShift,ADD_pstSolution);
+			ADD_pstSolution->u8Prescaler = Copy_u8Prescaler;
+		}
+		else
+		{
+			/*from the largest prescaler , the first within the tolerance has the fewest interrupts*/
+			uint32_t LOC_u32BestError = 0xFFFFFFFFUL;
+			uint32_t LOC_u32Tolerance = LOC_u32Cycles >> TSOLV_TOLERANCE_SHIFT;
+			for(uint8_t LOC_u8Prescaler = LOC_u8Prescalers ; LOC_u8Prescaler > 0 ; LOC_u8Prescaler--)
+			{
+				TSOLV_stSolution_t LOC_stSolution;
+				vSolveOne(LOC_u32Cycles,LOC_pu8Shifts[LOC_u8Prescaler - 1],LOC_u8SizeShift,&LOC_stSolution);
+				uint32_t LOC_u32Error = (LOC_stSolution.s32Error < 0) ? (uint32_t)(-LOC_stSolution.s32Error)
+										      : (uint32_t)LOC_stSolution.s32Error;
+				if(LOC_u32Error < LOC_u32BestError)
+				{
+					LOC_u32BestError = LOC_u32Error;
+					*ADD_pstSolution = LOC_stSolution;
+					ADD_pstSolution->u8Prescaler = LOC_u8Prescaler;
+				}
+				if(LOC_u32Error <= LOC_u32Tolerance)
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
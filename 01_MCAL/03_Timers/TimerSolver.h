@@ -0,0 +1,267 @@
+/*******************************************************************************/
+/**
+ * @file TimerSolver.h
+ * @brief Header file for the timers period solver
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the solver finds the prescaler , the compare value (TOP) and the number of
+ * interrupts of a period from the CPU clock with integer math only. the
+ * macros give the same result at compile time for a constant period and a
+ * known prescaler , TSOLV_enuSolve is used at run time and can choose the
+ * prescaler itself , trading the error against the number of interrupts.
+ * the achieved period and its error are returned with the solution.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef TIMER_SOLVER_H_
+#define TIMER_SOLVER_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/**
+*@brief passed as the prescaler to let the solver choose it.
+*/
+#define		TSOLV_ANY_PRESCALER			0
+
+/**
+*@brief the error which the solver accepts when it chooses the prescaler , it is
+*	(period / 2^TSOLV_TOLERANCE_SHIFT) , 10 is about 0.1%. the largest prescaler
+*	within it is taken so the interrupts are the fewest.
+*/
+#define		TSOLV_TOLERANCE_SHIFT			10
+
+/**
+*@brief the number of the ticks of each interrupt at most.
+*/
+#define		TSOLV_8BIT_TOP				256UL
+#define		TSOLV_16BIT_TOP				65536UL
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief the solver at compile time , _CLK is the CPU clock in Hz , _MS is the
+*	period in milli-seconds , _DIV is the division of the prescaler (1 , 8 ,
+*	64 ..) and _MAX is TSOLV_8BIT_TOP or TSOLV_16BIT_TOP.
+*	EX:- OCR0 = TSOLV_COMPARE(F_CPU,100,1024,TSOLV_8BIT_TOP);
+*/
+#define TSOLV_CYCLES(_CLK,_MS)			(((uint32_t)(_MS) * ((_CLK) / 1000UL)) + \
+						 (((uint32_t)(_MS) * ((_CLK) % 1000UL)) / 1000UL))
+
+#define TSOLV_TICKS_(_CLK,_MS,_DIV)		((TSOLV_CYCLES(_CLK,_MS) + ((_DIV) / 2)) / (_DIV))
+#define TSOLV_TICKS(_CLK,_MS,_DIV)		(TSOLV_TICKS_(_CLK,_MS,_DIV) == 0 ? 1UL : TSOLV_TICKS_(_CLK,_MS,_DIV))
+
+#define TSOLV_COUNT(_CLK,_MS,_DIV,_MAX)		((TSOLV_TICKS(_CLK,_MS,_DIV) + (_MAX) - 1) / (_MAX))
+
+#define TSOLV_TOP(_CLK,_MS,_DIV,_MAX)		((TSOLV_TICKS(_CLK,_MS,_DIV) + (TSOLV_COUNT(_CLK,_MS,_DIV,_MAX) / 2)) / \
+						 TSOLV_COUNT(_CLK,_MS,_DIV,_MAX))
+
+#define TSOLV_COMPARE(_CLK,_MS,_DIV,_MAX)	(TSOLV_TOP(_CLK,_MS,_DIV,_MAX) - 1)
+
+#define TSOLV_ACHIEVED_TICKS(_CLK,_MS,_DIV,_MAX) (TSOLV_TOP(_CLK,_MS,_DIV,_MAX) * TSOLV_COUNT(_CLK,_MS,_DIV,_MAX))
+
+#define TSOLV_ERROR(_CLK,_MS,_DIV,_MAX)		((sint32_t)((TSOLV_ACHIEVED_TICKS(_CLK,_MS,_DIV,_MAX) * (_DIV)) - \
+						 TSOLV_CYCLES(_CLK,_MS)))
+
+/**
+*@brief initializer of TSOLV_stSolution_t at compile time , _CS is the value
+*	of the clock select bits of the prescaler.
+*	EX:- static const TSOLV_stSolution_t stTick = TSOLV_SOLUTION(5,F_CPU,100,1024,TSOLV_8BIT_TOP);
+*/
+#define TSOLV_SOLUTION(_CS,_CLK,_MS,_DIV,_MAX)	{ (_CS) , TSOLV_COMPARE(_CLK,_MS,_DIV,_MAX) , \
+						  TSOLV_COUNT(_CLK,_MS,_DIV,_MAX) , TSOLV_ACHIEVED_TICKS(_CLK,_MS,_DIV,_MAX) , \
+						  TSOLV_ERROR(_CLK,_MS,_DIV,_MAX) }
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/**
+*@brief the timers , they differ in the size and the prescalers.
+*/
+typedef enum
+{
+	/**
+	*@brief 8-bit timer , prescalers 1 , 8 , 64 , 256 , 1024 (clock select 1 to 5).
+	*/
+	TSOLV_enuTimer0,
+
+	/**
+	*@brief 16-bit timer , prescalers 1 , 8 , 64 , 256 , 1024 (clock select 1 to 5).
+	*/
+	TSOLV_enuTimer1,
+
+	/**
+	*@brief 8-bit timer , prescalers 1 , 8 , 32 , 64 , 128 , 256 , 1024 (clock select 1 to 7).
+	*/
+	TSOLV_enuTimer2
+
+} TSOLV_enuTimer_t;
+
+
+/*
+*@brief these are all solver errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+	/**
+	*@brief returned if the function did it functionality correctly.
+	*/
+	TSOLV_enuOK,
+
+	/**
+	*@brief returned if the timer is not one of TSOLV_enuTimer_t.
+	*/
+	TSOLV_enuInvalidTimer,
+
+	/**
+	*@brief returned if the clock select value is not valid for the timer.
+	*/
+	TSOLV_enuInvalidPrescaler,
+
+	/**
+	*@brief returned if the period is zero or longer than 2^32 CPU cycles.
+	*/
+	TSOLV_enuInvalidPeriod,
+
+	/**
+	*@brief  returned if null pinter to function passed
+	*/
+	TSOLV_enuNullPtr
+
+} TSOLV_enuErrors_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/**
+*@brief the solution of one period.
+*/
+typedef struct
+{
+	/**
+	*@brief the value of the clock select bits of the prescaler.
+	*/
+	uint8_t u8Prescaler;
+
+	/**
+	*@brief the compare value in CTC mode , each interrupt is (u16Compare + 1) ticks.
+	*/
+	uint16_t u16Compare;
+
+	/**
+	*@brief the number of the interrupts of the period.
+	*/
+	uint32_t u32Count;
+
+	/**
+	*@brief the achieved period in timer ticks , (u16Compare + 1) * u32Count.
+	*	in normal mode the timer counts it by a preload.
+	*/
+	uint32_t u32Ticks;
+
+	/**
+	*@brief the achieved period minus the wanted period in CPU cycles.
+	*/
+	sint32_t s32Error;
+
+} TSOLV_stSolution_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief				finds the prescaler , the compare value and the
+*					number of interrupts of a period.
+*
+* @param[in] Copy_enuTimer		the timer (TSOLV_enuTimer0 , TSOLV_enuTimer1 ..).
+*
+* @param[in] Copy_u8Prescaler		the clock select value of the prescaler or
+*					TSOLV_ANY_PRESCALER to choose the largest
+*					prescaler within TSOLV_TOLERANCE_SHIFT , or the
+*					prescaler of the smallest error if none is within it.
+*
+* @param[in] Copy_u32ClockHz		the CPU clock in Hz.
+*
+* @param[in] Copy_u32PeriodMS		the period in milli-seconds.
+*
+* @param[out] ADD_pstSolution		the solution.
+*
+* @return the solver error status.
+*
+* @note					it uses shifts and one 32-bit division for each
+*					prescaler , call it before the critical section.
+*/
+TSOLV_enuErrors_t TSOLV_enuSolve(TSOLV_enuTimer_t Copy_enuTimer, uint8_t Copy_u8Prescaler, uint32_t Copy_u32ClockHz,
+				 uint32_t Copy_u32PeriodMS, TSOLV_stSolution_t * ADD_pstSolution);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* TIMER_SOLVER_H_ */
+/******************************************************************************/
@@ -71,6 +71,14 @@ extern "C"
 /*******************************************************************************/
 #define			TIMER0_ENABLE				OFF
 
+/**
+*@brief Timer0 is the tick of the kernel (04_Kernel) , ON or OFF. when it is
+*	OFF Timer0 is the time of the system time (02_SysTime) which is used by
+*	the protothreads , the scheduler and the CPU load. the kernel and the
+*	system time can't be built together.
+*/
+#define			TIMER0_KERNEL_ENABLE			OFF
+
 
 /*******************************************************************************/
 /*		       		     TIMER 1	                               */
@@ -78,11 +86,24 @@ extern "C"
 #define			TIMER1_ENABLE				ON
 #define			TIMER1_PWM_ENABLE			ON
 
+/**
+*@brief the number of the input capture timestamps which wait to be read ,
+*	it must be a power of two up to 128.
+*/
+#define			TIMER1_CAPTURE_BUFFER_SIZE		8
+
 /*******************************************************************************/
 /*		       		     TIMER 2	                               */
 /*******************************************************************************/
 #define			TIMER2_ENABLE				OFF
 
+/**
+*@brief Timer2 is clocked from a 32.768KHz watch crystal on TOSC1 and TOSC2
+*	(asynchronous mode) , it overflows once each second and keeps the
+*	calendar. it works in power-save sleep , ON or OFF.
+*/
+#define			TIMER2_RTC_ENABLE			OFF
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -7,14 +7,13 @@
  #include "../../00_LIB/Platform_Types.h"
  #include "Timer0.h"
  #include "../03_Timers/Reg.h"
+ #include "../03_Timers/TimerSolver.h"
  #include "../../00_LIB/BIT_MATH.h"
+ #include "../02_Interrupt/ISR.h"
+ #include "../02_Interrupt/Critical.h"
 
 
 
-/**
-*@brief   this refer to I bit in global interrupt.
-*/
-#define		SERG_INT_EN_BIT				7
 #define		CS02				        2
 #define		CS01				        1
 #define		CS00					0
@@ -37,19 +36,33 @@
 */
 #define		OCIE0					1
 
-/**
-*@brief used to convert the micro-second to milli-second.
-*/
-#define		 SECONDTOMILLI(MICRO)			(MICRO * 1000)
-
-
 #define		 SET_PRESCALLER(_PRESCALLER)		TCCR0 |= _PRESCALLER
 
 #define		CFG_IS_CURRENT_MODE(_MODE)		(PRESCALLER == _MODE)
+
 /**
-*@brief this is the time which will take to increase the timer by 1 .
+*@brief the clock select value of the configured prescaler.
 */
-static double TickTime =  0;
+#define		PRESCALLER_CS				(CFG_IS_CURRENT_MODE(PRESCALLER_1024) * 5	\
+							+ CFG_IS_CURRENT_MODE(PRESCALLER_256) * 4	\
+							+ CFG_IS_CURRENT_MODE(PRESCALLER_64) * 3	\
+							+ CFG_IS_CURRENT_MODE(PRESCALLER_8) * 2		\
+							+ CFG_IS_CURRENT_MODE(NO_PRESCALLER) * 1)
+
+#if COMPILATION_MODE == PRE_COMPILATION_MODE
+/**
+*@brief the solutions of the allowed tick times (100ms , 500ms , 1s , 2s and
+*	5s) , they are solved at compile time with the configured prescaler.
+*/
+static const TSOLV_stSolution_t astTickSolutions[] =
+{
+	TSOLV_SOLUTION(PRESCALLER_CS,F_CPU,100,PRESCALLER,TSOLV_8BIT_TOP),
+	TSOLV_SOLUTION(PRESCALLER_CS,F_CPU,500,PRESCALLER,TSOLV_8BIT_TOP),
+	TSOLV_SOLUTION(PRESCALLER_CS,F_CPU,1000,PRESCALLER,TSOLV_8BIT_TOP),
+	TSOLV_SOLUTION(PRESCALLER_CS,F_CPU,2000,PRESCALLER,TSOLV_8BIT_TOP),
+	TSOLV_SOLUTION(PRESCALLER_CS,F_CPU,5000,PRESCALLER,TSOLV_8BIT_TOP)
+};
+#endif
  #if COMPILATION_MODE == POST_COMPILATION_MODE
  TMR0Config_t *strTimerConfig = NULL;
  #endif
@@ -71,15 +84,30 @@ static uint32_t u32TickCount;
 static uint32_t u8CurrentTicksCount;
 
 
+/**
+* @brief Timer0 overflow and compare handlers , called from the vectors or the dispatcher.
+*/
+static void vOvfHandler(void * ADD_pvParam);
+static void vCompHandler(void * ADD_pvParam);
+
+/**
+* @brief attaches the handlers of the dispatched vectors.
+*/
+static void vAttachHandlers(void);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
 /**
 * @brief Timer0 overflow interrupt service routine .
 */
 void __vector_11(void) __attribute__((signal));
+#endif
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
 /**
 * @brief timer0 compare interrupt service routine;
 */
 void __vector_10(void) __attribute__((signal));
+#endif
 
 
 
@@ -92,11 +120,8 @@ void __vector_10(void) __attribute__((signal));
 			#if F_CPU == 0
 			#error "F_CPU Can't be zero."
 			#endif
-			/*calculate the time of tick in milli-seconds */
-			TickTime = SECONDTOMILLI(((double)PRESCALLER / F_CPU)) ;
 
-			/*Enable global interrupt by set */
-			SET_BIT(SREG,SERG_INT_EN_BIT);
+			vAttachHandlers();
 	}
 #endif
 
@@ -126,16 +151,7 @@ TMR0_enuErrorStatus_t TMR0_voidInitPostCompile(TMR0Config_t *Copy_strTimerConfig
 	}
 	else
 	{
-		uint16_t u8Prescaller = (Copy_strTimerConfig->enmPrescaller == enuNO_PRESCALLER) * 1  +
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_8)  * 8  + 
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_64) * 64 + 
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_256)* 256+
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_1024) *1024;
-
-		TickTime = SECONDTOMILLI(((double)u8Prescaller / F_CPU)) ;
-
-		/*Enable global interrupt by set */
-		SET_BIT(SREG,SERG_INT_EN_BIT);
+		vAttachHandlers();
 	}
 	return RET_enuErrorStatus;
 }
@@ -158,42 +174,73 @@ TMR0_enuErrorStatus_t TMR0_enuSetTickTimeMS(uint32_t Copy_u8DesiredTime,
 
 		RET_enuErrorStatus = TMR0_enuInvalidTimerInterval;
 	}
+	#if COMPILATION_MODE == POST_COMPILATION_MODE
 	else if(strTimerConfig->enmTimerMode == PWM)
+	#else
+	else if(TIMER_MODE == PWM)
+	#endif
 	{
 		RET_enuErrorStatus = TMR0_enuInvalidMode;
 	}
 	else
 	{
-		TCCR0 &= 0xF8;	
-		uint16_t NumberOfTick ;	
-		switch(Copy_u8InterruptSource)
+		TSOLV_stSolution_t LOC_stSolution;
+
+		#if COMPILATION_MODE == PRE_COMPILATION_MODE
+		/*solved at compile time*/
+		switch(Copy_u8DesiredTime)
+		{
+			case 100:	LOC_stSolution = astTickSolutions[0];	break;
+			case 500:	LOC_stSolution = astTickSolutions[1];	break;
+			case 1000:	LOC_stSolution = astTickSolutions[2];	break;
+			case 2000:	LOC_stSolution = astTickSolutions[3];	break;
+			default:		LOC_stSolution = astTickSolutions[4];	break;
+		}
+		#else
+		/*solved before the critical section with the configured prescaler*/
+		if(TSOLV_enuSolve(TSOLV_enuTimer0,strTimerConfig->enmPrescaller,F_CPU,Copy_u8DesiredTime,&LOC_stSolution) != TSOLV_enuOK)
 		{
-			case enuOVERFLOW:
-				u32TickCount =Copy_u8DesiredTime / (TickTime * 255);
-				TCNT0 = u8Preload = 255 - ((Copy_u8DesiredTime % ((uint16_t)(255 * TickTime))));
-				u32TickCount += (u8Preload > 0)?1:0;
-				uint8_t IntRegTemp = TIMSK;
-				SET_BIT(IntRegTemp,TOIE0);
-				CLR_BIT(IntRegTemp,OCIE0);
-				TIMSK = IntRegTemp;
-				break;
-				case enuCOMPARE_MATCH:
-				 NumberOfTick = (uint16_t)(Copy_u8DesiredTime / TickTime);
-				boolean u8NotFactor = TRUE;
-				for(uint8_t u32factor = 255 ; u8NotFactor ;u32factor--)
-				{
-					if(NumberOfTick % u32factor == 0)
-					{
-						OCR0 =  u8Preload = u32factor;
-						u8NotFactor = 0;
-					}
-				}
-				u32TickCount =  NumberOfTick / u8Preload;
-				uint8_t IntRegTemp2 = TIMSK;
-				CLR_BIT(IntRegTemp2,TOIE0);
-				SET_BIT(IntRegTemp2,OCIE0);
-				TIMSK = IntRegTemp2;
-				break;
+			RET_enuErrorStatus = TMR0_enuInvalidTimerInterval;
+		}
+		#endif
+
+		if(RET_enuErrorStatus == TMR0_enuOk)
+		{
+			TCCR0 &= 0xF8;	
+
+			/*the ISRs read the 32 bit tick count and the preload*/
+			uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+			u8CurrentTicksCount = 0;
+			switch(Copy_u8InterruptSource)
+			{
+				case enuOVERFLOW:
+					/*the overflows which cover the ticks , the first one is shortened by the preload*/
+					u32TickCount = (LOC_stSolution.u32Ticks + 255) >> 8;
+					TCNT0 = u8Preload = (u32TickCount << 8) - LOC_stSolution.u32Ticks;
+					uint8_t u8Temp = TCCR0;
+					CLR_BIT(u8Temp,WGM00);
+					CLR_BIT(u8Temp,WGM01);
+					TCCR0 = u8Temp;
+					uint8_t IntRegTemp = TIMSK;
+					SET_BIT(IntRegTemp,TOIE0);
+					CLR_BIT(IntRegTemp,OCIE0);
+					TIMSK = IntRegTemp;
+					break;
+					case enuCOMPARE_MATCH:
+					/*CTC mode , the timer is cleared after (OCR0 + 1) ticks*/
+					OCR0 =  u8Preload = LOC_stSolution.u16Compare;
+					u32TickCount = LOC_stSolution.u32Count;
+					uint8_t u8Temp2 = TCCR0;
+					CLR_BIT(u8Temp2,WGM00);
+					SET_BIT(u8Temp2,WGM01);
+					TCCR0 = u8Temp2;
+					uint8_t IntRegTemp2 = TIMSK;
+					CLR_BIT(IntRegTemp2,TOIE0);
+					SET_BIT(IntRegTemp2,OCIE0);
+					TIMSK = IntRegTemp2;
+					break;
+			}
+			CRITICAL_vExit(LOC_u8SREG);
 		}
 	}
 	return RET_enuErrorStatus;
@@ -202,13 +249,7 @@ TMR0_enuErrorStatus_t TMR0_enuSetTickTimeMS(uint32_t Copy_u8DesiredTime,
 TMR0_enuErrorStatus_t TMR0_enuStart(void)
 {
 	#if COMPILATION_MODE == PRE_COMPILATION_MODE
-		uint8_t u8Prescaler = 
-			CFG_IS_CURRENT_MODE(PRESCALLER_1024) * 5
-			+ CFG_IS_CURRENT_MODE(PRESCALLER_256) * 4
-			+ CFG_IS_CURRENT_MODE(PRESCALLER_64) * 3
-			+ CFG_IS_CURRENT_MODE(PRESCALLER_8) * 2
-			+ CFG_IS_CURRENT_MODE(NO_PRESCALLER) * 1;
-	SET_PRESCALLER(u8Prescaler);
+	SET_PRESCALLER(PRESCALLER_CS);
 
 	#elif COMPILATION_MODE == POST_COMPILATION_MODE
 		uint8_t u8Temp = TCCR0;
@@ -293,7 +334,16 @@ TMR0_enuErrorStatus_t TMR0_enuSetDutyCyclePhaseCorrection(uint8_t Copy_u8DutyCyc
 	return RET_enuErrorStatus;
 }
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
 void __vector_11(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER0_OVF);
+	vOvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER0_OVF);
+}
+#endif
+
+static void vOvfHandler(void * ADD_pvParam)
 {
 	/*the current number of counts */
 	uint32_t u8currentTicks = ++u8CurrentTicksCount;
@@ -310,16 +360,8 @@ void __vector_11(void)
 		/*restart the number of current Ticks counter */
 		u8CurrentTicksCount = 0;
 		 #if COMPILATION_MODE == POST_COMPILATION_MODE
-		/*if the callback function is not equal to null execute it*/
-		if( strTimerConfig->CallBack != NULL)
-		{
-			strTimerConfig->CallBack(
-			strTimerConfig->pFunctionParem);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		/*call the callback function or post it*/
+		ISR_vCallBack(strTimerConfig->CallBack,strTimerConfig->pFunctionParem);
 		#endif
 	}
 	else
@@ -330,7 +372,16 @@ void __vector_11(void)
 
 
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
 void __vector_10(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER0_COMP);
+	vCompHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER0_COMP);
+}
+#endif
+
+static void vCompHandler(void * ADD_pvParam)
 {
 	/*the current number of counts */
 	uint32_t u8currentTicks = ++u8CurrentTicksCount;
@@ -344,16 +395,8 @@ void __vector_10(void)
 		/*restart the number of current Ticks counter */
 		u8CurrentTicksCount = 0;
 		#if COMPILATION_MODE == POST_COMPILATION_MODE
-		/*if the callback function is not equal to null execute it*/
-		if( strTimerConfig->CallBack != NULL)
-		{
-			strTimerConfig->CallBack(
-			strTimerConfig->pFunctionParem);
-		}
-		else
-		{
-			/*No thing*/
-		}
+		/*call the callback function or post it*/
+		ISR_vCallBack(strTimerConfig->CallBack,strTimerConfig->pFunctionParem);
 		#endif
 	}
 	else
@@ -362,3 +405,13 @@ void __vector_10(void)
 	}
 }
 
+
+static void vAttachHandlers(void)
+{
+	#if ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
+	ISR_enuAttach(ISR_VECT_TIMER0_OVF,vOvfHandler,NULL);
+	#endif
+	#if ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
+	ISR_enuAttach(ISR_VECT_TIMER0_COMP,vCompHandler,NULL);
+	#endif
+}
@@ -7,33 +7,136 @@
 
  #include "Timer1.h"
  #include "Timer1_ex.h"
+ #include "../02_Interrupt/ISR.h"
+ #include "../02_Interrupt/Critical.h"
+ #include "../03_Timers/TimerSolver.h"
+ #include "../03_Timers/Timers_CFG.h"
 
+#if (TIMER1_CAPTURE_BUFFER_SIZE & (TIMER1_CAPTURE_BUFFER_SIZE - 1)) != 0 || \
+    TIMER1_CAPTURE_BUFFER_SIZE < 2 || TIMER1_CAPTURE_BUFFER_SIZE > 128
+#error TIMER1_CAPTURE_BUFFER_SIZE must be a power of two from 2 to 128.
+#endif
 
-static TMR1Config_t * CurrentConf = NULL;
 
-static uint64_t CLKAfterPrescaller = 0;
+static TMR1Config_t * CurrentConf = NULL;
 
 static uint16_t PreLoad = 0;
 
-static uint8_t NumberOfInterrupts = 0;
+static uint32_t NumberOfInterrupts = 0;
+
+static uint32_t OverFlowCnts = 0;
+
+/**
+*@brief the division of each prescaller , index 0 is enuNO_PRESCALLER.
+*/
+static const uint16_t au16Divisions[5] = {1 , 8 , 64 , 256 , 1024};
+
+/**
+*@brief the input capture , the overflows are the high 16 bits of the timestamps.
+*/
+static volatile boolean bCapturing = FALSE;
+
+static uint8_t CaptureEdges = TMR1_RISING_EDGE;
+
+static volatile uint16_t CaptureOverflows = 0;
+
+/**
+*@brief the ring of the captures , the head is moved by the ISR and the tail by the reader.
+*/
+static TMR1_stCapture_t astCaptures[TIMER1_CAPTURE_BUFFER_SIZE];
+
+static volatile uint8_t CaptureHead = 0;
+
+static volatile uint8_t CaptureTail = 0;
+
+/**
+*@brief set by the ISR when a capture is dropped because the ring is full ,
+*	cleared by TMR1_enuReadCapture and TMR1_enuGetCaptureOverrun.
+*/
+static volatile boolean bCaptureOverrun = FALSE;
+
+/**
+*@brief the last timestamp of each edge and the measures of the last period.
+*/
+static uint32_t au32LastEdge[2];
+
+static uint32_t CapturePeriod = 0;
+
+static uint32_t CaptureHighTime = 0;
+
+/**
+*@brief bit 0 and 1 are set after the first falling and rising edges , then
+*	the period and the high time are valid.
+*/
+static volatile uint8_t CaptureValid = 0;
+
+#define		PERIOD_VALID		2
+#define		HIGH_TIME_VALID		3
+
+/**
+*@brief the 16-bit PWM , TOP and the compare values are the last asked ones.
+*	TOP isn't double buffered , so a new TOP is written by the overflow
+*	interrupt in two periods : the compare values first (the hardware takes
+*	them at the next period) then TOP at the start of that period. in fast
+*	PWM with the prescaller 64 or more the overflow comes while the counter
+*	is still at TOP , then all of them are written in one interrupt.
+*/
+static uint8_t PWMMode = TMR1_FAST_PWM_ICR1;
+
+static uint16_t PWMTop = 0;
+
+static volatile uint16_t au16PWMCompare[2];
+
+static volatile uint16_t InflightTop = 0;
+
+static volatile uint8_t PWMUpdateStage = 0;
+
+#define		PWM_UPDATE_NONE		0
+#define		PWM_UPDATE_COMPARE	1
+#define		PWM_UPDATE_TOP		2
+
+/**
+* @brief Timer1 overflow and compare handlers , called from the vectors or the dispatcher.
+*/
+static void vOvfHandler(void * ADD_pvParam);
+static void vCompHandler(void * ADD_pvParam);
+static void vCaptHandler(void * ADD_pvParam);
 
-static uint8_t OverFlowCnts = 0;
+/**
+* @brief finds TOP of the 16-bit PWM frequency with the prescaller of the configuration.
+*/
+static boolean bSolvePWMTop(uint8_t Copy_u8Mode, uint32_t Copy_u32FrequencyHz, uint16_t * ADD_pu16Top);
 
+/**
+* @brief one step of the change of TOP , called from the overflow interrupt.
+*/
+static void vPWMUpdate(void);
 
-static uint64_t  NumberOfTicks = 0;
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_CAPT)
+/**
+* @brief Timer1 input capture interrupt service routine.
+*/
+void __vector_6(void) __attribute__((signal));
+#endif
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
 /**
 * @brief Timer1 overflow interrupt service routine.
 */
 void __vector_9(void) __attribute__((signal));
+#endif
 
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
 /**
 * @brief timer1 compare interrupt service routine.
 */
 void __vector_7(void) __attribute__((signal));
+#endif
 
- double ValueInComp  = 0;
- double prestage =  100;
+ /**
+ *@brief the compare value of the 100% duty cycle.
+ */
+ #define	PWM_TOP			1023UL
 
 TMR1_enuErrorStatus_t TMR1_voidInit(TMR1Config_t *Copy_strTimerConfig)
 {
@@ -44,15 +147,18 @@ TMR1_enuErrorStatus_t TMR1_voidInit(TMR1Config_t *Copy_strTimerConfig)
 	}
 	else
 	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the ISRs use the configuration*/
 		CurrentConf = Copy_strTimerConfig;
-		uint16_t u16Prescaller = (Copy_strTimerConfig->enmPrescaller == enuNO_PRESCALLER) * 1  +
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_8)  * 8  +
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_64) * 64 +
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_256)* 256+
-					(Copy_strTimerConfig->enmPrescaller == enuPRESCALLER_1024) * 1024;
-
-		CLKAfterPrescaller = Copy_strTimerConfig->CLK / u16Prescaller;
-		SREG |= (1 << SERG_INT_EN_BIT);
+		CRITICAL_vExit(LOC_u8SREG);
+		#if ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
+		ISR_enuAttach(ISR_VECT_TIMER1_OVF,vOvfHandler,NULL);
+		#endif
+		#if ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
+		ISR_enuAttach(ISR_VECT_TIMER1_COMPA,vCompHandler,NULL);
+		#endif
+		#if ISR_IS_DISPATCHED(ISR_VECT_TIMER1_CAPT)
+		ISR_enuAttach(ISR_VECT_TIMER1_CAPT,vCaptHandler,NULL);
+		#endif
 	}
 	return RET_enuErrorStatus;
 }
@@ -71,42 +177,51 @@ TMR1_enuErrorStatus_t TMR1_enuSetTickTimeMS(uint32_t Copy_u8DesiredTime, uint8_t
 	}
 	else
 	{
-		uint8_t EnabledEnterrupt = TIMSK;
-		EnabledEnterrupt &= 195;
-		double timePerTick  = 0;
-		switch(Copy_u8InterruptSource)
-		{
-			case enuOVERFLOW:
-				EnabledEnterrupt |= (1 <<  TOIE1);
-				timePerTick = ((double)1000 / CLKAfterPrescaller);
-				NumberOfTicks = ((double)Copy_u8DesiredTime / timePerTick);
-				PreLoad = (65535 - (NumberOfTicks % 65535));
-				PreLoad = ((PreLoad == 65535) ? 0 : PreLoad);
-				NumberOfInterrupts = NumberOfTicks / 65535;
-				NumberOfInterrupts += ((PreLoad > 0)? 1 :0);
-				TCNT1 = PreLoad;
-				break;
-			case enuCOMPARE_MATCH:
-				EnabledEnterrupt |= (1 <<  OCIE1A);
-				timePerTick = ((double)1000 / CLKAfterPrescaller);
-				NumberOfTicks = ((double)Copy_u8DesiredTime / timePerTick);
-				boolean Acceptable = FALSE;
-				uint64_t Value = 0;
-				for(uint64_t Factor = 1 ; Factor * Factor <= NumberOfTicks && !Acceptable ; Factor++)
-				{
-					if(NumberOfInterrupts % Factor == 0 && NumberOfTicks/ Factor <= 65535)
-					{
-						Acceptable = TRUE;
-						Value = NumberOfTicks/ Factor;
-					}
-				}
-				OCR1A = Value;
-				NumberOfInterrupts = NumberOfTicks / Value; 
-				break;
-			default:
-				break;
+		/*solved before the critical section with the configured prescaler*/
+		TSOLV_stSolution_t LOC_stSolution;
+		TSOLV_enuErrors_t LOC_enuSolver = TSOLV_enuSolve(TSOLV_enuTimer1,CurrentConf->enmPrescaller,(uint32_t)CurrentConf->CLK,
+								 Copy_u8DesiredTime,&LOC_stSolution);
+		if(LOC_enuSolver == TSOLV_enuInvalidPrescaler)
+		{
+			RET_enuErrorStatus = TMR1_inValidPrescaller;
+		}
+		else if(LOC_enuSolver != TSOLV_enuOK)
+		{
+			RET_enuErrorStatus = TMR1_enuInvalidTimerInterval;
+		}
+		else
+		{
+			uint8_t EnabledEnterrupt = TIMSK;
+			EnabledEnterrupt &= 195;
+
+			/*the ISRs read the preload and the number of interrupts , and the 16 bit registers share one temp register*/
+			uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+			OverFlowCnts = 0;
+			bCapturing   = FALSE;						/*the tick changes the mode , the capture interrupt is cleared below*/
+			TCCR1A &= ~((1 << WGM11) | (1 << WGM10));
+			switch(Copy_u8InterruptSource)
+			{
+				case enuOVERFLOW:
+					/*normal mode , the overflows cover the ticks and the first one is shortened by the preload*/
+					EnabledEnterrupt |= (1 <<  TOIE1);
+					TCCR1B &= ~((1 << WGM13) | (1 << WGM12));
+					NumberOfInterrupts = (LOC_stSolution.u32Ticks + 65535UL) >> 16;
+					PreLoad = (uint16_t)((NumberOfInterrupts << 16) - LOC_stSolution.u32Ticks);
+					TCNT1 = PreLoad;
+					break;
+				case enuCOMPARE_MATCH:
+					/*CTC mode , the timer is cleared after (OCR1A + 1) ticks*/
+					EnabledEnterrupt |= (1 <<  OCIE1A);
+					TCCR1B = (TCCR1B & ~(1 << WGM13)) | (1 << WGM12);
+					OCR1A = LOC_stSolution.u16Compare;
+					NumberOfInterrupts = LOC_stSolution.u32Count;
+					break;
+				default:
+					break;
+			}
+			TIMSK = EnabledEnterrupt;
+			CRITICAL_vExit(LOC_u8SREG);
 		}
-		TIMSK = EnabledEnterrupt;
 	}
 	return RET_enuErrorStatus;
 }
@@ -162,9 +277,11 @@ TMR1_enuErrorStatus_t TMR1_enuSetDutyCycleFastPWM(uint8_t Copy_u8DutyCycle, uint
 			default: 
 				break;
 		}
-		 ValueInComp = ((Copy_u8DutyCycle * 1023UL) / prestage);
-		OCR1A = ((uint16_t)ValueInComp);
+		uint16_t LOC_u16Compare = (uint16_t)((Copy_u8DutyCycle * PWM_TOP) / 100);
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the 16 bit registers share one temp register with the ISRs*/
+		OCR1A = LOC_u16Compare;
 		TCNT1 = 0;
+		CRITICAL_vExit(LOC_u8SREG);
 	}
 	return RET_enuErrorStatus;
 }
@@ -202,49 +319,542 @@ TMR1_enuErrorStatus_t TMR1_enuSetDutyCyclePhaseCorrection(uint8_t Copy_u8DutyCyc
 			default:
 			break;
 		}
-		 ValueInComp = ((Copy_u8DutyCycle * 1023UL) / prestage);
-		 OCR1A = ((uint16_t)ValueInComp);
+		 uint16_t LOC_u16Compare = (uint16_t)((Copy_u8DutyCycle * PWM_TOP) / 100);
+		 uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the 16 bit registers share one temp register with the ISRs*/
+		 OCR1A = LOC_u16Compare;
 		 TCNT1 = 0;
+		 CRITICAL_vExit(LOC_u8SREG);
 	}
 	return RET_enuErrorStatus;
 }
 
 
+TMR1_enuErrorStatus_t TMR1_enuStartCapture(uint8_t Copy_u8Edge, boolean Copy_bNoiseCanceler)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(CurrentConf == NULL || CurrentConf->enmTimerMode == enuPWM)
+	{
+		RET_enuErrorStatus = TMR1_enuError;
+	}
+	else if(Copy_u8Edge > TMR1_BOTH_EDGES)
+	{
+		RET_enuErrorStatus = TMR1_enuInvalidEdge;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the ISRs use the ring and the 16 bit registers*/
+		NumberOfInterrupts = 0;
+		OverFlowCnts       = 0;
+		CaptureOverflows   = 0;
+		CaptureHead        = 0;
+		CaptureTail        = 0;
+		CaptureValid       = 0;
+		bCaptureOverrun    = FALSE;
+		CaptureEdges       = Copy_u8Edge;
+
+		/*normal mode , the counter runs to 0xFFFF so the overflows extend it*/
+		TCCR1A &= ~((1 << WGM11) | (1 << WGM10));
+		TCCR1B &= ~((1 << WGM13) | (1 << WGM12) | (1 << ICNC1) | (1 << ICES1));
+		if(Copy_bNoiseCanceler == TRUE)
+		{
+			TCCR1B |= (1 << ICNC1);
+		}
+		if(Copy_u8Edge != TMR1_FALLING_EDGE)
+		{
+			TCCR1B |= (1 << ICES1);
+		}
+		TIFR  = (1 << ICF1) | (1 << TOV1);					/*the edge change may set the flag , clear it by writing one*/
+		TIMSK = (TIMSK & ~(1 << OCIE1A)) | (1 << TOIE1) | (1 << TICIE1);
+		bCapturing = TRUE;
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+	return RET_enuErrorStatus;
+}
 
 
-void __vector_9(void) 
+TMR1_enuErrorStatus_t TMR1_enuStopCapture(void)
 {
-	OverFlowCnts++;
-	if(NumberOfInterrupts == OverFlowCnts)
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	TIMSK &= ~(1 << TICIE1);
+	if(bCapturing == TRUE)
 	{
-		OverFlowCnts = 0;
-		TCNT1 = PreLoad;
-		if(CurrentConf->CallBack == NULL)
+		TIMSK &= ~(1 << TOIE1);							/*no tick is running with the capture*/
+	}
+	bCapturing = FALSE;
+	CRITICAL_vExit(LOC_u8SREG);
+	return RET_enuErrorStatus;
+}
+
+
+TMR1_enuErrorStatus_t TMR1_enuReadCapture(TMR1_stCapture_t * ADD_pstCapture)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(ADD_pstCapture == NULL)
+	{
+		RET_enuErrorStatus = TMR1_enuNullPtr;
+	}
+	else if(CaptureTail == CaptureHead)
+	{
+		RET_enuErrorStatus = TMR1_enuNoCapture;
+	}
+	else
+	{
+		/*only the ISR moves the head , the capture is written before it*/
+		*ADD_pstCapture = astCaptures[CaptureTail];
+		CaptureTail = (CaptureTail + 1) & (TIMER1_CAPTURE_BUFFER_SIZE - 1);
+		if(bCaptureOverrun == TRUE)
 		{
-			
+			bCaptureOverrun = FALSE;
+			RET_enuErrorStatus = TMR1_enuOverrun;
+		}
+	}
+	return RET_enuErrorStatus;
+}
+
+
+TMR1_enuErrorStatus_t TMR1_enuGetCaptureOverrun(boolean * ADD_pbOverrun)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(ADD_pbOverrun == NULL)
+	{
+		RET_enuErrorStatus = TMR1_enuNullPtr;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the ISR may set it between the read and the clear*/
+		*ADD_pbOverrun  = bCaptureOverrun;
+		bCaptureOverrun = FALSE;
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+	return RET_enuErrorStatus;
+}
+
+
+TMR1_enuErrorStatus_t TMR1_enuGetCapturePeriod(uint32_t * ADD_pu32Ticks)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(ADD_pu32Ticks == NULL)
+	{
+		RET_enuErrorStatus = TMR1_enuNullPtr;
+	}
+	else if((CaptureValid & (1 << PERIOD_VALID)) == 0)
+	{
+		RET_enuErrorStatus = TMR1_enuNoCapture;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the ISR changes the 32 bit value*/
+		*ADD_pu32Ticks = CapturePeriod;
+		CRITICAL_vExit(LOC_u8SREG);
+		if(bCaptureOverrun == TRUE)
+		{
+			RET_enuErrorStatus = TMR1_enuOverrun;			/*the value is valid , the flag stays for the reader*/
+		}
+	}
+	return RET_enuErrorStatus;
+}
+
+
+TMR1_enuErrorStatus_t TMR1_enuGetCaptureFrequency(uint32_t * ADD_pu32FrequencyHz)
+{
+	uint32_t LOC_u32Period = 0;
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuGetCapturePeriod(&LOC_u32Period);
+	if(ADD_pu32FrequencyHz == NULL)
+	{
+		RET_enuErrorStatus = TMR1_enuNullPtr;
+	}
+	else if(RET_enuErrorStatus == TMR1_enuOk || RET_enuErrorStatus == TMR1_enuOverrun)
+	{
+		uint32_t LOC_u32Division = au16Divisions[CurrentConf->enmPrescaller - 1];
+		if(LOC_u32Period > (0xFFFFFFFFUL / LOC_u32Division))
+		{
+			*ADD_pu32FrequencyHz = 0;						/*longer than 2^32 cycles , less than one Hz*/
 		}
 		else
 		{
-			CurrentConf->CallBack(CurrentConf->pFunctionParem);
+			uint32_t LOC_u32Cycles = LOC_u32Period * LOC_u32Division;
+			*ADD_pu32FrequencyHz = ((uint32_t)CurrentConf->CLK + (LOC_u32Cycles >> 1)) / LOC_u32Cycles;
 		}
 	}
+	return RET_enuErrorStatus;
 }
 
-void __vector_7(void)
+
+TMR1_enuErrorStatus_t TMR1_enuGetCaptureDutyCycle(uint8_t * ADD_pu8DutyCycle)
 {
-	OverFlowCnts++;
-	if(NumberOfInterrupts == OverFlowCnts)
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(ADD_pu8DutyCycle == NULL)
 	{
-		OverFlowCnts = 0;
+		RET_enuErrorStatus = TMR1_enuNullPtr;
+	}
+	else if(CaptureEdges != TMR1_BOTH_EDGES)
+	{
+		RET_enuErrorStatus = TMR1_enuInvalidEdge;
+	}
+	else if((CaptureValid & ((1 << PERIOD_VALID) | (1 << HIGH_TIME_VALID))) != ((1 << PERIOD_VALID) | (1 << HIGH_TIME_VALID)))
+	{
+		RET_enuErrorStatus = TMR1_enuNoCapture;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the ISR changes the 32 bit values*/
+		uint32_t LOC_u32Period   = CapturePeriod;
+		uint32_t LOC_u32HighTime = CaptureHighTime;
+		CRITICAL_vExit(LOC_u8SREG);
+
+		uint32_t LOC_u32Duty = (LOC_u32HighTime <= (0xFFFFFFFFUL / 100)) ? ((LOC_u32HighTime * 100) / LOC_u32Period)
+										   : (LOC_u32HighTime / (LOC_u32Period / 100));
+		*ADD_pu8DutyCycle = (LOC_u32Duty > 100) ? 100 : (uint8_t)LOC_u32Duty;
+		if(bCaptureOverrun == TRUE)
+		{
+			RET_enuErrorStatus = TMR1_enuOverrun;
+		}
+	}
+	return RET_enuErrorStatus;
+}
+
+
+
+
+TMR1_enuErrorStatus_t TMR1_enuInitPWM16(uint8_t Copy_u8Mode, uint32_t Copy_u32FrequencyHz)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	uint16_t LOC_u16Top = 0;
+	if(CurrentConf == NULL || CurrentConf->enmTimerMode != enuPWM)
+	{
+		RET_enuErrorStatus = TMR1_enuError;
+	}
+	else if(Copy_u8Mode != TMR1_FAST_PWM_ICR1 && Copy_u8Mode != TMR1_PHASE_FREQ_CORRECT_ICR1)
+	{
+		RET_enuErrorStatus = TMR1_enuInvalidMode;
+	}
+	else if(bSolvePWMTop(Copy_u8Mode,Copy_u32FrequencyHz,&LOC_u16Top) == FALSE)
+	{
+		RET_enuErrorStatus = TMR1_enuInvalidTimerInterval;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the ISRs use the state and the 16 bit registers*/
+		NumberOfInterrupts = 0;
+		bCapturing         = FALSE;
+		PWMUpdateStage     = PWM_UPDATE_NONE;
+		PWMMode            = Copy_u8Mode;
+		PWMTop             = LOC_u16Top;
+		InflightTop        = LOC_u16Top;
+		au16PWMCompare[TMR1_CHANNEL_A] = 0;
+		au16PWMCompare[TMR1_CHANNEL_B] = 0;
+		TIMSK &= ~((1 << TICIE1) | (1 << OCIE1A) | (1 << TOIE1));
+
+		/*mode 14 (fast) or mode 8 (phase and frequency correct) , the outputs are disconnected*/
+		TCCR1A = (Copy_u8Mode == TMR1_FAST_PWM_ICR1) ? (1 << WGM11) : 0;
+		TCCR1B = (TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10))) | (1 << WGM13) |
+			 ((Copy_u8Mode == TMR1_FAST_PWM_ICR1) ? (1 << WGM12) : 0);
+		ICR1  = LOC_u16Top;
+		OCR1A = 0;
+		OCR1B = 0;
 		TCNT1 = 0;
-		if(CurrentConf->CallBack == NULL)
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+	return RET_enuErrorStatus;
+}
+
+
+TMR1_enuErrorStatus_t TMR1_enuSetPWMFrequency(uint32_t Copy_u32FrequencyHz)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	uint16_t LOC_u16Top = 0;
+	if(CurrentConf == NULL || CurrentConf->enmTimerMode != enuPWM || PWMTop == 0)
+	{
+		RET_enuErrorStatus = TMR1_enuError;
+	}
+	else if(bSolvePWMTop(PWMMode,Copy_u32FrequencyHz,&LOC_u16Top) == FALSE)
+	{
+		RET_enuErrorStatus = TMR1_enuInvalidTimerInterval;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the overflow interrupt takes the new values*/
+		for(uint8_t LOC_u8Channel = TMR1_CHANNEL_A ; LOC_u8Channel <= TMR1_CHANNEL_B ; LOC_u8Channel++)
+		{
+			/*the same duty cycle with the new TOP*/
+			au16PWMCompare[LOC_u8Channel] = (uint16_t)((((uint32_t)au16PWMCompare[LOC_u8Channel] * LOC_u16Top) +
+								   (PWMTop >> 1)) / PWMTop);
+		}
+		PWMTop = LOC_u16Top;
+		if(PWMUpdateStage == PWM_UPDATE_NONE)
+		{
+			PWMUpdateStage = PWM_UPDATE_COMPARE;
+			TIFR   = (1 << TOV1);						/*the next overflow is the start of a new period*/
+			TIMSK |= (1 << TOIE1);
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+	return RET_enuErrorStatus;
+}
+
+
+TMR1_enuErrorStatus_t TMR1_enuSetPWMCompare(uint8_t Copy_u8Channel, uint16_t Copy_u16Compare, uint8_t Copy_u8PWMType)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(CurrentConf == NULL || CurrentConf->enmTimerMode != enuPWM || PWMTop == 0)
+	{
+		RET_enuErrorStatus = TMR1_enuError;
+	}
+	else if(Copy_u8Channel != TMR1_CHANNEL_A && Copy_u8Channel != TMR1_CHANNEL_B)
+	{
+		RET_enuErrorStatus = TMR1_enuInvalidChannel;
+	}
+	else if(Copy_u16Compare > PWMTop)
+	{
+		RET_enuErrorStatus = TMR1_enuNotValidDutyCycle;
+	}
+	else if(Copy_u8PWMType != TMR1_INVERTED && Copy_u8PWMType != TMR1_NON_INVERTED)
+	{
+		RET_enuErrorStatus = TMR1_enuNotValidPWMType;
+	}
+	else
+	{
+		uint8_t LOC_u8COM1 = (Copy_u8Channel == TMR1_CHANNEL_A) ? COM1A1 : COM1B1;
+		uint8_t LOC_u8COM0 = (Copy_u8Channel == TMR1_CHANNEL_A) ? COM1A0 : COM1B0;
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the 16 bit registers share one temp register with the ISRs*/
+		TCCR1A |= (1 << LOC_u8COM1);
+		if(Copy_u8PWMType == TMR1_INVERTED)
 		{
-			
+			TCCR1A |= (1 << LOC_u8COM0);
 		}
 		else
 		{
-			CurrentConf->CallBack(CurrentConf->pFunctionParem);
+			TCCR1A &= ~(1 << LOC_u8COM0);
 		}
+		au16PWMCompare[Copy_u8Channel] = Copy_u16Compare;
+
+		/*while TOP is changing the compare value is written by the overflow interrupt*/
+		if(PWMUpdateStage == PWM_UPDATE_NONE || (PWMUpdateStage == PWM_UPDATE_TOP && InflightTop == PWMTop))
+		{
+			if(Copy_u8Channel == TMR1_CHANNEL_A)
+			{
+				OCR1A = Copy_u16Compare;
+			}
+			else
+			{
+				OCR1B = Copy_u16Compare;
+			}
+		}
+		CRITICAL_vExit(LOC_u8SREG);
 	}
+	return RET_enuErrorStatus;
+}
 
-}
\ No newline at end of file
+
+TMR1_enuErrorStatus_t TMR1_enuSetPWMDuty(uint8_t Copy_u8Channel, uint16_t Copy_u16Duty, uint8_t Copy_u8PWMType)
+{
+	TMR1_enuErrorStatus_t RET_enuErrorStatus = TMR1_enuOk;
+	if(Copy_u16Duty > 10000)
+	{
+		RET_enuErrorStatus = TMR1_enuNotValidDutyCycle;
+	}
+	else
+	{
+		uint16_t LOC_u16Compare = (uint16_t)((((uint32_t)Copy_u16Duty * PWMTop) + 5000UL) / 10000UL);
+		RET_enuErrorStatus = TMR1_enuSetPWMCompare(Copy_u8Channel,LOC_u16Compare,Copy_u8PWMType);
+	}
+	return RET_enuErrorStatus;
+}
+
+
+uint16_t TMR1_u16GetPWMTop(void)
+{
+	return PWMTop;
+}
+
+
+static boolean bSolvePWMTop(uint8_t Copy_u8Mode, uint32_t Copy_u32FrequencyHz, uint16_t * ADD_pu16Top)
+{
+	boolean RET_bSolved = FALSE;
+	if(CurrentConf->enmPrescaller >= enuNO_PRESCALLER && CurrentConf->enmPrescaller <= enuPRESCALLER_1024)
+	{
+		uint32_t LOC_u32Clock    = (uint32_t)CurrentConf->CLK;
+		uint32_t LOC_u32Division = au16Divisions[CurrentConf->enmPrescaller - 1];
+
+		/*four ticks at least , so the step below doesn't overflow*/
+		if(Copy_u32FrequencyHz != 0 && Copy_u32FrequencyHz <= ((LOC_u32Clock / LOC_u32Division) >> 2))
+		{
+			uint32_t LOC_u32Step = LOC_u32Division * Copy_u32FrequencyHz;
+			uint32_t LOC_u32Top;
+			if(Copy_u8Mode == TMR1_FAST_PWM_ICR1)
+			{
+				/*the period is (TOP + 1) ticks*/
+				LOC_u32Top = ((LOC_u32Clock + (LOC_u32Step >> 1)) / LOC_u32Step) - 1;
+			}
+			else
+			{
+				/*the counter goes up and down , the period is (2 * TOP) ticks*/
+				LOC_u32Top = (LOC_u32Clock + LOC_u32Step) / (LOC_u32Step << 1);
+			}
+			if(LOC_u32Top >= 3 && LOC_u32Top <= 0xFFFFUL)
+			{
+				*ADD_pu16Top = (uint16_t)LOC_u32Top;
+				RET_bSolved  = TRUE;
+			}
+		}
+	}
+	return RET_bSolved;
+}
+
+
+static void vPWMUpdate(void)
+{
+	if(PWMMode == TMR1_FAST_PWM_ICR1 && CurrentConf->enmPrescaller >= enuPRESCALLER_64)
+	{
+		/*the overflow is at TOP and a tick is longer than the latency of the interrupt , so the counter
+		  is still at TOP and the buffers are taken at its next tick. the clock is stopped (one tick may
+		  be lost) and the whole new period is written before that tick*/
+		uint8_t LOC_u8Clock = TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10));
+		TCCR1B &= ~LOC_u8Clock;
+		if(TCNT1 == ICR1)
+		{
+			OCR1A = au16PWMCompare[TMR1_CHANNEL_A];
+			OCR1B = au16PWMCompare[TMR1_CHANNEL_B];
+			if(ICR1 != PWMTop)
+			{
+				ICR1  = PWMTop;
+				TCNT1 = PWMTop;							/*the counter is cleared at the next tick as with the old TOP*/
+			}
+			InflightTop    = PWMTop;
+			PWMUpdateStage = PWM_UPDATE_NONE;
+			TIMSK &= ~(1 << TOIE1);
+		}
+		TCCR1B |= LOC_u8Clock;
+	}
+
+	/*here the counter has left TOP (the prescaller 1 and 8 are shorter than the latency of the interrupt)*/
+	if(PWMUpdateStage == PWM_UPDATE_COMPARE)
+	{
+		/*taken by the hardware at the start of the next period*/
+		OCR1A = au16PWMCompare[TMR1_CHANNEL_A];
+		OCR1B = au16PWMCompare[TMR1_CHANNEL_B];
+		InflightTop    = PWMTop;
+		PWMUpdateStage = PWM_UPDATE_TOP;
+	}
+	else if(PWMUpdateStage == PWM_UPDATE_TOP)
+	{
+		/*the counter has just started the period of the new compare values*/
+		ICR1 = InflightTop;
+		if(InflightTop != PWMTop)
+		{
+			PWMUpdateStage = PWM_UPDATE_COMPARE;				/*changed again while it was in flight*/
+		}
+		else
+		{
+			PWMUpdateStage = PWM_UPDATE_NONE;
+			TIMSK &= ~(1 << TOIE1);
+		}
+	}
+}
+
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
+void __vector_9(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_OVF);
+	vOvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_OVF);
+}
+#endif
+
+static void vOvfHandler(void * ADD_pvParam)
+{
+	if(bCapturing == TRUE)
+	{
+		CaptureOverflows++;
+	}
+	if(PWMUpdateStage != PWM_UPDATE_NONE)
+	{
+		vPWMUpdate();
+	}
+	OverFlowCnts++;
+	if(NumberOfInterrupts != 0 && NumberOfInterrupts == OverFlowCnts)
+	{
+		OverFlowCnts = 0;
+		TCNT1 = PreLoad;
+		ISR_vCallBack(CurrentConf->CallBack,CurrentConf->pFunctionParem);
+	}
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
+void __vector_7(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_COMPA);
+	vCompHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_COMPA);
+}
+#endif
+
+static void vCompHandler(void * ADD_pvParam)
+{
+	OverFlowCnts++;
+	if(NumberOfInterrupts == OverFlowCnts)
+	{
+		OverFlowCnts = 0;
+		ISR_vCallBack(CurrentConf->CallBack,CurrentConf->pFunctionParem);
+	}
+
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_CAPT)
+void __vector_6(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_CAPT);
+	vCaptHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_CAPT);
+}
+#endif
+
+static void vCaptHandler(void * ADD_pvParam)
+{
+	uint16_t LOC_u16Capture   = ICR1;
+	uint16_t LOC_u16Overflows = CaptureOverflows;
+	uint8_t LOC_u8Edge        = (TCCR1B & (1 << ICES1)) ? TMR1_RISING_EDGE : TMR1_FALLING_EDGE;
+
+	/*the counter wrapped before the capture and its interrupt is not served yet*/
+	if((TIFR & (1 << TOV1)) && LOC_u16Capture < 0x8000)
+	{
+		LOC_u16Overflows++;
+	}
+	uint32_t LOC_u32TimeStamp = ((uint32_t)LOC_u16Overflows << 16) | LOC_u16Capture;
+
+	if(CaptureEdges == TMR1_BOTH_EDGES)
+	{
+		TCCR1B ^= (1 << ICES1);
+		TIFR    = (1 << ICF1);							/*the edge change may set the flag*/
+	}
+
+	if(LOC_u8Edge == TMR1_FALLING_EDGE && CaptureEdges == TMR1_BOTH_EDGES)
+	{
+		if(CaptureValid & (1 << TMR1_RISING_EDGE))
+		{
+			CaptureHighTime = LOC_u32TimeStamp - au32LastEdge[TMR1_RISING_EDGE];
+			CaptureValid |= (1 << HIGH_TIME_VALID);
+		}
+	}
+	else if(CaptureValid & (1 << LOC_u8Edge))
+	{
+		CapturePeriod = LOC_u32TimeStamp - au32LastEdge[LOC_u8Edge];
+		CaptureValid |= (1 << PERIOD_VALID);
+	}
+	au32LastEdge[LOC_u8Edge] = LOC_u32TimeStamp;
+	CaptureValid |= (1 << LOC_u8Edge);
+
+	uint8_t LOC_u8Next = (CaptureHead + 1) & (TIMER1_CAPTURE_BUFFER_SIZE - 1);
+	if(LOC_u8Next != CaptureTail)
+	{
+		astCaptures[CaptureHead].u32TimeStamp = LOC_u32TimeStamp;
+		astCaptures[CaptureHead].u8Edge       = LOC_u8Edge;
+		CaptureHead = LOC_u8Next;
+	}
+	else
+	{
+		bCaptureOverrun = TRUE;
+	}
+}
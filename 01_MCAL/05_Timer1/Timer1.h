@@ -42,6 +42,28 @@
 
 	TMR1_enuNotValidPWMType ,
 
+	/**
+	*@brief  returned if the capture edge is not one of TMR1_enuCaptureEdges.
+	*/
+	TMR1_enuInvalidEdge ,
+
+	/**
+	*@brief  returned if there is no capture to read or not enough captures to measure.
+	*/
+	TMR1_enuNoCapture ,
+
+	/**
+	*@brief  returned if the channel is not one of TMR1_enuPWMChannels.
+	*/
+	TMR1_enuInvalidChannel ,
+
+	/**
+	*@brief returned with a valid capture or measure if some captures were lost
+	*	because the ring was full , the captures around the lost ones are not
+	*	continuous.
+	*/
+	TMR1_enuOverrun ,
+
 	TMR1_enuError
 
  } TMR1_enuErrorStatus_t;
@@ -81,6 +103,36 @@ typedef enum
 	TMR1_NON_INVERTED
 } TMR1_enuPWMTypes;
 
+
+/**
+*@brief the 16-bit PWM modes , ICR1 is TOP in both so the frequency is set
+*	without losing OC1A. fast PWM has the double frequency of the phase and
+*	frequency correct PWM for the same TOP , the correct PWM is symmetric and
+*	its compare values are updated at BOTTOM.
+*/
+typedef enum
+{
+	TMR1_FAST_PWM_ICR1 ,
+	TMR1_PHASE_FREQ_CORRECT_ICR1
+} TMR1_enuPWM16Modes;
+
+typedef enum
+{
+	TMR1_CHANNEL_A ,
+	TMR1_CHANNEL_B
+} TMR1_enuPWMChannels;
+
+/**
+*@brief the edges of the ICP1 pin which are captured , with both edges the
+*	edge is changed after each capture so the duty cycle can be measured.
+*/
+typedef enum
+{
+	TMR1_FALLING_EDGE ,
+	TMR1_RISING_EDGE ,
+	TMR1_BOTH_EDGES
+} TMR1_enuCaptureEdges;
+
 typedef enum
 {
 	enuNOT_PWM_TIMER ,
@@ -105,6 +157,19 @@ typedef struct
 } TMR1Config_t;
 
 
+/**
+*@brief one input capture , the timestamp is ICR1 extended by the overflows
+*	in Timer1 ticks and the edge is TMR1_FALLING_EDGE or TMR1_RISING_EDGE.
+*/
+typedef struct
+{
+	uint32_t u32TimeStamp;
+
+	uint8_t u8Edge;
+
+} TMR1_stCapture_t;
+
+
 
 TMR1_enuErrorStatus_t TMR1_voidInit(TMR1Config_t *Copy_strTimerConfig);
 
@@ -119,3 +184,99 @@ TMR1_enuErrorStatus_t TMR1_enuSetDutyCycleFastPWM(uint8_t Copy_u8DutyCycle, uint
 
 
 TMR1_enuErrorStatus_t TMR1_enuSetDutyCyclePhaseCorrection(uint8_t Copy_u8DutyCycle, uint8_t Copy_u8PWMType);
+
+
+/**
+* @brief starts the input capture , Timer1 is changed to normal mode and the
+*	tick of TMR1_enuSetTickTimeMS is stopped. the timer runs after TMR1_enuStart.
+*
+* @param[in] Copy_u8Edge		TMR1_FALLING_EDGE , TMR1_RISING_EDGE or TMR1_BOTH_EDGES.
+*
+* @param[in] Copy_bNoiseCanceler	TRUE to accept the edge after four equal samples
+*					of the pin , it delays the capture four CPU cycles.
+*
+* @note the captures are stored in a ring of TIMER1_CAPTURE_BUFFER_SIZE , a
+*	capture is dropped when the ring is full and the overrun flag is set ,
+*	see TMR1_enuGetCaptureOverrun.
+*/
+TMR1_enuErrorStatus_t TMR1_enuStartCapture(uint8_t Copy_u8Edge, boolean Copy_bNoiseCanceler);
+
+
+TMR1_enuErrorStatus_t TMR1_enuStopCapture(void);
+
+
+/**
+* @brief reads the oldest capture from the ring , TMR1_enuNoCapture if it is empty.
+*	TMR1_enuOverrun is returned with the capture if some were lost , then the flag is cleared.
+*/
+TMR1_enuErrorStatus_t TMR1_enuReadCapture(TMR1_stCapture_t * ADD_pstCapture);
+
+
+/**
+* @brief reads and clears the overrun flag , TRUE if a capture was dropped
+*	because the ring was full since the last clear.
+*/
+TMR1_enuErrorStatus_t TMR1_enuGetCaptureOverrun(boolean * ADD_pbOverrun);
+
+
+/**
+* @brief the ticks between the last two rising edges (or the two edges of the
+*	selected edge) , they are not removed from the ring. TMR1_enuOverrun is
+*	returned with the value while the overrun flag is set.
+*/
+TMR1_enuErrorStatus_t TMR1_enuGetCapturePeriod(uint32_t * ADD_pu32Ticks);
+
+
+/**
+* @brief the frequency in Hz of the last period from the clock of the configuration.
+*/
+TMR1_enuErrorStatus_t TMR1_enuGetCaptureFrequency(uint32_t * ADD_pu32FrequencyHz);
+
+
+/**
+* @brief the high time of the last period in percent , needs TMR1_BOTH_EDGES.
+*/
+TMR1_enuErrorStatus_t TMR1_enuGetCaptureDutyCycle(uint8_t * ADD_pu8DutyCycle);
+
+
+/**
+* @brief starts the 16-bit PWM with ICR1 as TOP , both channels are
+*	disconnected until their duty cycle is set. the timer runs after TMR1_enuStart.
+*
+* @param[in] Copy_u8Mode		TMR1_FAST_PWM_ICR1 or TMR1_PHASE_FREQ_CORRECT_ICR1.
+*
+* @param[in] Copy_u32FrequencyHz	the PWM frequency , TOP is from 3 to 0xFFFF
+*					with the prescaller of the configuration.
+*
+* @note the resolution is one step of TOP , EX:- 20KHz fast PWM at 8MHz without
+*	prescaller is TOP 399 (0.25%). OC1A (PD5) and OC1B (PD4) must be outputs.
+*/
+TMR1_enuErrorStatus_t TMR1_enuInitPWM16(uint8_t Copy_u8Mode, uint32_t Copy_u32FrequencyHz);
+
+
+/**
+* @brief changes the PWM frequency , the compare values are scaled to keep the
+*	duty cycles. TOP and the compare values change together at the start of
+*	a period (in the overflow interrupt) so no period is cut or doubled.
+*/
+TMR1_enuErrorStatus_t TMR1_enuSetPWMFrequency(uint32_t Copy_u32FrequencyHz);
+
+
+/**
+* @brief sets the compare value of one channel from 0 to TOP , the hardware
+*	double buffer changes it at the start of the next period.
+*/
+TMR1_enuErrorStatus_t TMR1_enuSetPWMCompare(uint8_t Copy_u8Channel, uint16_t Copy_u16Compare, uint8_t Copy_u8PWMType);
+
+
+/**
+* @brief sets the duty cycle of one channel in 0.01% from 0 to 10000 , it is
+*	rounded to the nearest step of TOP.
+*/
+TMR1_enuErrorStatus_t TMR1_enuSetPWMDuty(uint8_t Copy_u8Channel, uint16_t Copy_u16Duty, uint8_t Copy_u8PWMType);
+
+
+/**
+* @brief the TOP of the 16-bit PWM , the number of the duty cycle steps.
+*/
+uint16_t TMR1_u16GetPWMTop(void);
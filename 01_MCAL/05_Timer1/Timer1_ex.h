@@ -14,8 +14,14 @@
 
 #define		OCR1A			*((volatile uint16_t*)0x4A)
 
+#define		OCR1B			*((volatile uint16_t*)0x48)
+
+#define		ICR1			*((volatile uint16_t*)0x46)
+
 #define		TIMSK			*((volatile uint8_t*)0x59)
 
+#define		TIFR			*((volatile uint8_t*)0x58)
+
 
 #define		SREG			*((volatile uint8_t *)0x5F)
 
@@ -23,6 +29,12 @@
 
  #define        TOIE1			2
 
+ #define        TICIE1			5
+
+ #define        ICF1			5
+
+ #define        TOV1			2
+
  #define	SERG_INT_EN_BIT		7
 
 
@@ -7,16 +7,13 @@
 
  #include "../../00_LIB/Platform_Types.h"
  #include "ADC.h"
+ #include "../02_Interrupt/ISR.h"
+ #include "../02_Interrupt/Critical.h"
 
  #define ADC_BASE		0x24
 
  #define ADC			((tstADCRegistrs *)ADC_BASE)
 
- #define	SREG			*((volatile uint8_t *)0x5F)
-
-
- #define	SERG_INT_EN_BIT		7
-
  /* ADCSRA */
  #define ADEN    7
  #define ADSC    6
@@ -62,10 +59,22 @@
 } tstADCRegistrs;
 
 
+/**
+* @brief ADC Conversion Complete handler , called from the vector or the dispatcher.
+*/
+static void vADCHandler(void * ADD_pvParam);
+
+/**
+* @brief calls the user callback , used to post it as a deferred work.
+*/
+static void vCallUserCallback(void * ADD_pvParam);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_ADC)
 /**
 * @brief ADC Conversion Complete Interrupt service routine. 
 */
 void __vector_16(void) __attribute__((signal));
+#endif
 
 static void (*Callback)(void) = NULL;
 
@@ -115,7 +124,9 @@ ADC_enuErrorStatus_t ADC_vInit(ADC_tstInitConfig* pstADCInit)
 		ADCSRA_temp |= pstADCInit->enmPrescalerSelections ;
 		ADCSRA_temp |= (pstADCInit->enmInterruptType << ADIE);
 		ADC->u8Adcsra = ADCSRA_temp;
-		SREG |= (1 << SERG_INT_EN_BIT);
+		#if ISR_IS_DISPATCHED(ISR_VECT_ADC)
+		ISR_enuAttach(ISR_VECT_ADC,vADCHandler,NULL);
+		#endif
 
 	}
 	return RET_ErrorStatus;
@@ -187,12 +198,29 @@ ADC_enuErrorStatus_t ADC_enuSetADCCallBack(void(*ADC_Callback)(void))
 	}
 	else
 	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
 		Callback = ADC_Callback;
+		CRITICAL_vExit(LOC_u8SREG);
 	}
 	return RET_ErrorStatus;
 }
 
+static void vCallUserCallback(void * ADD_pvParam)
+{
+	if(Callback != NULL)
+		Callback();
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_ADC)
 void __vector_16(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_ADC);
+	vADCHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_ADC);
+}
+#endif
+
+static void vADCHandler(void * ADD_pvParam)
 {
 	strChain->Result[Idx_Conversion++] = (ADC->u8Adcl | (ADC->u8Adch << 8));
 	if(Idx_Conversion != strChain->ChannelsNumber)
@@ -203,8 +231,7 @@ void __vector_16(void)
 	}
 	else
 	{
-		if(Callback != NULL)
-			Callback();
+		ISR_vCallBack(vCallUserCallback,NULL);
 		ADC_Working = 0;
 		Idx_Conversion = 0;
 		ADC->u8Adcsra &= ~(1 << ADEN);
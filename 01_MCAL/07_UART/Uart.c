@@ -23,6 +23,7 @@
 /******************************************************************************/
 
 #include "Uart.h"
+#include "../02_Interrupt/ISR.h"
 /******************************************************************************/
 
 /******************************************************************************/
@@ -34,6 +35,9 @@
 #define   UCSRC       (*(unsigned volatile char*)0x40)
 #define BIT_UDRE0      (5)
 #define BIT_RXC0       (7)
+#define BIT_TXC0       (6)
+#define BIT_U2X0       (1)
+#define BIT_MPCM0      (0)
 #define UCSZn2         (2)
 #define USBSn          (3)
 #define UPMn0          (4)
@@ -81,6 +85,7 @@ typedef struct
     void (*pfnReciveBufferCallback)(void *, uint16_t);
     int ReciveBufferindex;
     bool bRecivedFlag;
+    volatile bool bSendingFlag;
 
 } tstUartHandle;
 
@@ -122,13 +127,41 @@ static tstUartHandle astHandles[NUM_OF_HANDLES] =
 /* PRIVATE FUNCTION PROTOTYPES */
 /******************************************************************************/
 void  vTransmitByte(void *pvUartHnd, uint8_t u8Byte, uint16_t u16TimeOut);
+
+/**
+* @brief writes a byte to UDR and marks the port as sending until its TXC.
+*/
+static void vWriteUdr(tstUartHandle *pstHandle, uint8_t u8Byte);
 uint8_t u8ReceiveByte(void *pvUartHnd, uint16_t u16TimeOut);
+
+/**
+* @brief the receive complete and the transmit complete handlers of the
+*	interrupt buffers , called from the vectors or the dispatcher.
+*/
+static void vRxcHandler(void * ADD_pvParam);
+static void vTxcHandler(void * ADD_pvParam);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_USART_RXC)
+void __vector_13(void) __attribute__((signal));
+#endif
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_USART_TXC)
+void __vector_15(void) __attribute__((signal));
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
 /* PRIVATE FUNCTION DEFINITIONS */
 /******************************************************************************/
 
+static void vWriteUdr(tstUartHandle *pstHandle, uint8_t u8Byte)
+{
+    /* TXC is cleared by writing one , U2X and MPCM are kept and the error flags are written zero */
+    pstHandle->pstUartMemRegs->u8UcsrA = (pstHandle->pstUartMemRegs->u8UcsrA & ((1 << BIT_U2X0) | (1 << BIT_MPCM0))) | (1 << BIT_TXC0);
+    pstHandle->bSendingFlag = true;
+    pstHandle->pstUartMemRegs->u8Udr = u8Byte;
+}
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -147,6 +180,12 @@ void *Uart_pvInit(Uart_tstInitConfig *UartInit)
     temp |=  ((UartInit->enmStopBits << USBSn) | (UartInit->enmParityType << UPMn0));
     astHandles[UartInit->u8UartIdx].pstUartMemRegs->u8UcsrC |= ((1 << 7) | temp);
     astHandles[UartInit->u8UartIdx].bRecivedFlag = 0;
+#if ISR_IS_DISPATCHED(ISR_VECT_USART_RXC)
+    ISR_enuAttach(ISR_VECT_USART_RXC, vRxcHandler, &astHandles[UartInit->u8UartIdx]);
+#endif
+#if ISR_IS_DISPATCHED(ISR_VECT_USART_TXC)
+    ISR_enuAttach(ISR_VECT_USART_TXC, vTxcHandler, &astHandles[UartInit->u8UartIdx]);
+#endif
     return (void *)&astHandles[UartInit->u8UartIdx];
 }
 
@@ -168,7 +207,7 @@ void vTransmitByte(void *pvUartHnd, uint8_t u8Byte, uint16_t u16TimeOut)
         return;
     }
 
-    UART_HND->pstUartMemRegs->u8Udr = u8Byte;
+    vWriteUdr(UART_HND, u8Byte);
 }
 
 uint8_t u8ReceiveByte(void *pvUartHnd, uint16_t u16TimeOut)
@@ -205,7 +244,7 @@ void Uart_vTransmitBuff(void *pvUartHnd, void *pvBuff, uint16_t u16Length, void
     for (int idx = 0; idx < u16Length; idx++)
     {
         while (!(UART_HND->pstUartMemRegs->u8UcsrA & (1 << BIT_UDRE0)));
-        UART_HND->pstUartMemRegs->u8Udr = ((uint8_t *)pvBuff)[idx];
+        vWriteUdr(UART_HND, ((uint8_t *)pvBuff)[idx]);
     }
 
     if (pfnCallback != NULL)
@@ -281,7 +320,7 @@ void Uart_vTransmitBuffInterrupt(void *pvUartHnd, void *pvBuff, uint16_t u16Leng
     UART_HND->SendBufferindex = 1;
     UART_HND->pfnSendBufferCallback = pfnCallback;
     UART_HND->u16SendBufferLength = u16Length;
-    UART_HND->pstUartMemRegs->u8Udr = ((uint8_t *)pvBuff)[0];
+    vWriteUdr(UART_HND, ((uint8_t *)pvBuff)[0]);
 }
 
 void Uart_vReceiveBuffInterrupt(void *pvUartHnd, void *pvBuff, uint16_t u16Length, void (*pfnCallback)(void *, uint16_t))
@@ -297,3 +336,87 @@ void Uart_vReceiveBuffInterrupt(void *pvUartHnd, void *pvBuff, uint16_t u16Lengt
     UART_HND->u16ReciveBufferLength = u16Length;
 }
 
+bool Uart_bIsBusy(void)
+{
+    for (uint8_t u8Idx = 0; u8Idx < NUM_OF_HANDLES; u8Idx++)
+    {
+        tstUartHandle * pstHandle = &astHandles[u8Idx];
+
+        /* without the TXC interrupt the flag stays set , the last byte has left the shift register */
+        if (pstHandle->bSendingFlag && (pstHandle->pstUartMemRegs->u8UcsrA & (1 << BIT_TXC0)))
+        {
+            pstHandle->bSendingFlag = false;
+        }
+
+        /*an interrupt buffer is not finished or a byte is in UDR or in the shift register*/
+        if (pstHandle->pvSendBuffer != NULL || pstHandle->pvReciveBuffer != NULL || pstHandle->bSendingFlag)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_USART_RXC)
+void __vector_13(void)
+{
+    ISR_TRACE_ENTER(ISR_VECT_USART_RXC);
+    vRxcHandler(&astHandles[0]);
+    ISR_TRACE_EXIT(ISR_VECT_USART_RXC);
+}
+#endif
+
+static void vRxcHandler(void * ADD_pvParam)
+{
+    tstUartHandle * pstHandle = (tstUartHandle *)ADD_pvParam;
+
+    /* reading UDR clears the flag , the byte is dropped if no buffer is waiting */
+    uint8_t u8Data = pstHandle->pstUartMemRegs->u8Udr;
+    if (pstHandle->pvReciveBuffer != NULL && pstHandle->ReciveBufferindex < pstHandle->u16ReciveBufferLength)
+    {
+        ((uint8_t *)pstHandle->pvReciveBuffer)[pstHandle->ReciveBufferindex++] = u8Data;
+        if (pstHandle->ReciveBufferindex == pstHandle->u16ReciveBufferLength)
+        {
+            void *pvBuff = pstHandle->pvReciveBuffer;
+            pstHandle->pvReciveBuffer = NULL;
+            if (pstHandle->pfnReciveBufferCallback != NULL)
+            {
+                (*pstHandle->pfnReciveBufferCallback)(pvBuff, pstHandle->u16ReciveBufferLength);
+            }
+        }
+    }
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_USART_TXC)
+void __vector_15(void)
+{
+    ISR_TRACE_ENTER(ISR_VECT_USART_TXC);
+    vTxcHandler(&astHandles[0]);
+    ISR_TRACE_EXIT(ISR_VECT_USART_TXC);
+}
+#endif
+
+static void vTxcHandler(void * ADD_pvParam)
+{
+    tstUartHandle * pstHandle = (tstUartHandle *)ADD_pvParam;
+
+    /* the interrupt cleared TXC , a next byte marks the port again */
+    pstHandle->bSendingFlag = false;
+    if (pstHandle->pvSendBuffer == NULL)
+    {
+        /* the complete of a polled transmit */
+    }
+    else if (pstHandle->SendBufferindex < pstHandle->u16SendBufferLength)
+    {
+        vWriteUdr(pstHandle, ((uint8_t *)pstHandle->pvSendBuffer)[pstHandle->SendBufferindex++]);
+    }
+    else
+    {
+        void *pvBuff = pstHandle->pvSendBuffer;
+        pstHandle->pvSendBuffer = NULL;
+        if (pstHandle->pfnSendBufferCallback != NULL)
+        {
+            (*pstHandle->pfnSendBufferCallback)(pvBuff, pstHandle->u16SendBufferLength);
+        }
+    }
+}
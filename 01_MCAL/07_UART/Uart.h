@@ -151,6 +151,8 @@ void Uart_vTransmitBuffTimeout(void* pvUartHnd,void* pvBuff, uint16_t u16Length,
 void Uart_vReceiveBuffTimeout(void* pvUartHnd,void* pvBuff, uint16_t u16Length, uint16_t u16Timeout, void (*pfnCallback)(void*, uint16_t));
 void Uart_vTransmitBuffInterrupt(void* pvUartHnd,void* pvBuff, uint16_t u16Length, void (*pfnCallback)(void*, uint16_t));
 void Uart_vReceiveBuffInterrupt(void* pvUartHnd,void* pvBuff, uint16_t u16Length, void (*pfnCallback)(void*, uint16_t));
+/* true while an interrupt buffer is sent or received or the last byte is not shifted out (TXC) , the UART clock must not be stopped by the sleep */
+bool Uart_bIsBusy(void);
 /******************************************************************************/
 
 /******************************************************************************/
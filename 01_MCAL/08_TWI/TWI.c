@@ -23,6 +23,7 @@
 /* INCLUDES */
 /******************************************************************************/
 #include "TWI.h"
+#include "../02_Interrupt/ISR.h"
 #include <math.h>
 /******************************************************************************/
 
@@ -55,8 +56,6 @@
 #define TWPS1   1
 #define TWPS0   0
 
-#define		SREG			*((volatile uint8_t *)0x5F)
-
 
 /**
  * @brief Start condition transmitted.
@@ -253,13 +252,34 @@ static Service service = 0;
 /******************************************************************************/
 /* PRIVATE FUNCTION PROTOTYPES */
 /******************************************************************************/
+
+/**
+* @brief the TWI handler , called from the vector or the dispatcher.
+*/
+static void vTWIHandler(void * ADD_pvParam);
+
+/**
+* @brief calls the callback of the handle at the end of an interrupt transfer.
+*/
+static void vTransferComplete(void);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TWI)
 void __vector_19(void) __attribute__((signal));
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
 /* PRIVATE FUNCTION DEFINITIONS */
 /******************************************************************************/
 
+static void vTransferComplete(void)
+{
+	if(TWI_Handle != NULL && TWI_Handle->CallBack != NULL)
+	{
+		TWI_Handle->CallBack();
+	}
+}
+
 
 /******************************************************************************/
 
@@ -285,6 +305,9 @@ TWI_ErrorStatusTypeDef TWI_Init(TWI_HandleTypeDef *htwi)
 		TWI->TWAR  |= (htwi->Init.GeneralCallRecogantioon);
 		TWI->TWCR  &= ~(1 << TWIE);
 		TWI->TWCR  |= (htwi->Init.interrupt << TWIE);
+		#if ISR_IS_DISPATCHED(ISR_VECT_TWI)
+		ISR_enuAttach(ISR_VECT_TWI,vTWIHandler,NULL);
+		#endif
 	}
 	return RET_enuErrorStatus;
 }
@@ -591,7 +614,6 @@ TWI_ErrorStatusTypeDef TWI_Mem_Write_IT(TWI_HandleTypeDef *htwi, uint16_t DevAdd
 		EEPROM_Write.MemAddress = MemAddress;
 		TWI_Busy= 1;
 		service = WRITE_EEPROM_DATA;
-		SREG |= (1 << 7);
 		EEPROM_Write.cnt = 0;
 		TWI->TWCR = ((1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE));
 		return 1;
@@ -608,14 +630,29 @@ TWI_ErrorStatusTypeDef TWI_Mem_Read_IT(TWI_HandleTypeDef *htwi, uint16_t DevAddr
 			EEPROM_Write.MemAddress = MemAddress;
 			TWI_Busy= 1;
 			service = READ_EEPROM_DATA;
-			SREG |= (1 << 7);
 			EEPROM_Write.cnt = 0;
 			TWI->TWCR = ((1 << TWINT) | (1 << TWSTA) | (1 << TWEN) | (1 << TWIE));
 		return 1;
 		}
 		return 0;
 }
+
+boolean TWI_Is_Busy(void)
+{
+	/*the handler clears TWI_Busy when it writes TWSTO , the STOP is on the bus until the hardware clears TWSTO*/
+	return (TWI_Busy == 1 || (TWI->TWCR & (1 << TWSTO))) ? TRUE : FALSE;
+}
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TWI)
 void __vector_19(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TWI);
+	vTWIHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TWI);
+}
+#endif
+
+static void vTWIHandler(void * ADD_pvParam)
 {
 	uint8_t status = TWI->TWSR;
 	if(service == WRITE_EEPROM_DATA)
@@ -640,6 +677,7 @@ void __vector_19(void)
 		{
 			TWI_Busy = 0;
 			TWI->TWCR = ((1 << TWINT) | (1 << TWEN) | (1 << TWSTO));
+			vTransferComplete();
 		}
 	}
 	else if(service == READ_EEPROM_DATA)
@@ -672,6 +710,7 @@ void __vector_19(void)
 			*((uint8_t*)EEPROM_Write.data) = TWI->TWDR;
 			TWI_Busy = 0;
 			TWI->TWCR = ((1 << TWINT) | (1 << TWEN) | (1 << TWSTO));
+			vTransferComplete();
 
 		}
 	}
@@ -295,6 +295,12 @@ TWI_ErrorStatusTypeDef TWI_Mem_Write_IT(TWI_HandleTypeDef *htwi, uint16_t DevAdd
  */
 TWI_ErrorStatusTypeDef TWI_Mem_Read_IT(TWI_HandleTypeDef *htwi, uint16_t DevAddress,
 					uint16_t MemAddress, uint8_t *add);
+
+/**
+ * @brief Check if an interrupt transfer is in progress
+ * @return TRUE until the STOP of the transfer has left the bus (TWSTO is cleared)
+ */
+boolean TWI_Is_Busy(void);
 /******************************************************************************/
 
 /******************************************************************************/
@@ -97,9 +97,9 @@ extern const LED_stLedCFG LED_caLedsCFG[NUMBER_OF_LEDS];
 LED_enmErrors_t LED_enmInit(void)
 {
 	LED_enmErrors_t RET_enmErrorStatus	= LED_enmOK;			/*return of the function initialize with LED_enmOK*/
-	PORT_enmError_t LOC_enmErrorStatus	= PORT_enmOk;			/*Local return status error form function PORT_enmSetCfg() */
+	PORT_enmError_t LOC_enmErrorStatus	= PORT_enmOk;			/*Local return status error form function PORT_enmSetCfgBatch() */
 	PORT_enmConfig_t LOC_enuPinCfg		=  PORT_enmOutputHigh;	/*contain the default pin state as output */
-	PORT_stPortCfg_t LOC_stPinCFG		= {0};					/*contain default pin Configuration like port and pin*/
+	PORT_stPortCfg_t LOC_astPinsCFG[NUMBER_OF_LEDS] = {0};		/*contain the Configuration of all leds like port and pin*/
 	boolean LOC_bExit					= FALSE;				/*variable for exit the for loop , following MISRA*/
 	for(uint8_t LOC_u8led = 0 ; LOC_u8led < NUMBER_OF_LEDS && !LOC_bExit ; LOC_u8led++)
 	{
@@ -130,25 +130,25 @@ LED_enmErrors_t LED_enmInit(void)
 				LOC_enuPinCfg = PORT_enmOutputLOW;									/*the pin port is low*/
 			}
 			
-			LOC_stPinCFG.enmPin  = LED_caLedsCFG[LOC_u8led].enmPin;					/*init the configuration led for the port */
-			LOC_stPinCFG.enmPort = LED_caLedsCFG[LOC_u8led].enmPort;
-			LOC_stPinCFG.enmPinConf = LOC_enuPinCfg;
-			
-			LOC_enmErrorStatus = PORT_enmSetCfg(&LOC_stPinCFG);						/*Trying to set the pin configuration*/
-			if(LOC_enmErrorStatus == PORT_enmPortInvalid)							/*check if the port is invalid*/
-			{
-				RET_enmErrorStatus = LED_enmInvalidPort;							/*return invalid status*/
-				LOC_bExit = TRUE;													/*will exit the the init process*/
-			}
-			else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)					/*check if the pin out of valid range */
-			{
-				RET_enmErrorStatus = LED_enmInvalidPin;								/*return the pin is not valid*/
-				LOC_bExit = TRUE;													/*exit the init process*/
-			}
-			else
-			{
-				/*Do nothing*/
-			}
+			LOC_astPinsCFG[LOC_u8led].enmPin  = LED_caLedsCFG[LOC_u8led].enmPin;	/*init the configuration led for the port */
+			LOC_astPinsCFG[LOC_u8led].enmPort = LED_caLedsCFG[LOC_u8led].enmPort;
+			LOC_astPinsCFG[LOC_u8led].enmPinConf = LOC_enuPinCfg;
+		}
+	}
+	if(!LOC_bExit)
+	{
+		LOC_enmErrorStatus = PORT_enmSetCfgBatch(LOC_astPinsCFG,NUMBER_OF_LEDS);	/*Trying to set all pins together*/
+		if(LOC_enmErrorStatus == PORT_enmPortInvalid)							/*check if the port is invalid*/
+		{
+			RET_enmErrorStatus = LED_enmInvalidPort;							/*return invalid status*/
+		}
+		else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)					/*check if the pin out of valid range */
+		{
+			RET_enmErrorStatus = LED_enmInvalidPin;								/*return the pin is not valid*/
+		}
+		else
+		{
+			/*Do nothing*/
 		}
 	}
 	return RET_enmErrorStatus;														/*return function execution status*/
@@ -74,8 +74,8 @@ const LED_stLedCFG LED_caLedsCFG[NUMBER_OF_LEDS] =
 {
 	[FIRST_LED] = 
 	{
-		.enmPort = PORT_enmPortA ,
-		.enmPin  = PORT_enumPin1,
+		.enmPort = FIRST_LED_PORT ,
+		.enmPin  = FIRST_LED_PIN,
 		.enmActivationState = LED_enuActiveHigh,
 		.enmLedCfg = LED_enmOff
 	} 
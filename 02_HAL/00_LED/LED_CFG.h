@@ -57,6 +57,17 @@ extern "C"
 /**************************************************************************/
 #define FIRST_LED				0		/*The first led*/
 
+/**
+* @brief the port and the pin of each led (PORT_NUM_PORTx and PORT_NUM_PINy).
+*/
+#define FIRST_LED_PORT				PORT_NUM_PORTA
+#define FIRST_LED_PIN				PORT_NUM_PIN8
+
+/**
+* @brief the pins of all leds in the port _P , add each led which you configure.
+*/
+#define LED_PINS(_P)				(PORT_PIN_BIT(FIRST_LED_PORT,FIRST_LED_PIN,_P))
+
 
 /******************************************************************************/
 
@@ -36,14 +36,14 @@ const SWITCH_stSqitchCFG_t SWITCH_caSwitchesCFG[NUMBER_OF_SWITCHS]
 {
 	[FIRST_SWITCH] =
 	{
-		.enmPort = PORT_enmPortC,
-		.enmPin  = PORT_enumPin1,
+		.enmPort = FIRST_SWITCH_PORT,
+		.enmPin  = FIRST_SWITCH_PIN,
 		.enmSwitchState = SWITCH_enmPullUp
 	},
 	[SECOND_SWITCH] =
 	{
-		.enmPin  = PORT_enumPin2,
-		.enmPort = PORT_enmPortC,
+		.enmPin  = SECOND_SWITCH_PIN,
+		.enmPort = SECOND_SWITCH_PORT,
 		.enmSwitchState = SWITCH_enmPullUp
 	}
 };
@@ -52,6 +52,21 @@ extern "C"
 #define SECOND_SWITCH				1
 
 #define THIRD_SWITCH				2
+
+/**
+* @brief the port and the pin of each switch (PORT_NUM_PORTx and PORT_NUM_PINy).
+*/
+#define FIRST_SWITCH_PORT			PORT_NUM_PORTC
+#define FIRST_SWITCH_PIN			PORT_NUM_PIN1
+
+#define SECOND_SWITCH_PORT			PORT_NUM_PORTC
+#define SECOND_SWITCH_PIN			PORT_NUM_PIN2
+
+/**
+* @brief the pins of all switches in the port _P , add each switch which you configure.
+*/
+#define SWITCH_PINS(_P)				(PORT_PIN_BIT(FIRST_SWITCH_PORT,FIRST_SWITCH_PIN,_P) | \
+						 PORT_PIN_BIT(SECOND_SWITCH_PORT,SECOND_SWITCH_PIN,_P))
 /******************************************************************************/
 
 /******************************************************************************/
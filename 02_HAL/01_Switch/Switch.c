@@ -101,9 +101,9 @@ SWITCH_enmErrors_t SWITCH_enmInit(void)
 {
 	/*Validation*/
 	SWITCH_enmErrors_t RET_enuErrorStatus = SWITCH_enuOK;									/*function return status initialized with No Error */
-	PORT_enmError_t LOC_enuErrorStatus = PORT_enmOk;										/*this is the return status of PORT_enmSetCfg function*/
+	PORT_enmError_t LOC_enuErrorStatus = PORT_enmOk;										/*this is the return status of PORT_enmSetCfgBatch function*/
 	boolean LOC_bExit = FALSE;																/*to exist the loop if the function execution not success*/
-	PORT_stPortCfg_t LOC_stPinCFG		= {0};												/*contain default pin Configuration like port and pin*/
+	PORT_stPortCfg_t LOC_astPinsCFG[NUMBER_OF_SWITCHS] = {0};								/*contain the Configuration of all switches like port and pin*/
 	for(int LOC_Switch = 0; LOC_Switch  < NUMBER_OF_SWITCHS && !LOC_bExit; LOC_Switch++)	/*Loop in each configured switch*/
 	{
 		if(SWITCH_caSwitchesCFG[LOC_Switch].enmSwitchState > SWITCH_enmPullUp ||			/*Check if Switch has bad Status should be(pullup/pulldown)*/
@@ -114,34 +114,35 @@ SWITCH_enmErrors_t SWITCH_enmInit(void)
 		}
 		else
 		{
-			LOC_stPinCFG.enmPin  = SWITCH_caSwitchesCFG[LOC_Switch].enmPin;					/*set pin configuration*/
-			LOC_stPinCFG.enmPort = SWITCH_caSwitchesCFG[LOC_Switch].enmPort;				/*set port configuration*/
+			LOC_astPinsCFG[LOC_Switch].enmPin  = SWITCH_caSwitchesCFG[LOC_Switch].enmPin;	/*set pin configuration*/
+			LOC_astPinsCFG[LOC_Switch].enmPort = SWITCH_caSwitchesCFG[LOC_Switch].enmPort;	/*set port configuration*/
 			if(SWITCH_caSwitchesCFG[LOC_Switch].enmSwitchState == SWITCH_enmPullUp)			/*check if the button state is pull-up*/
 			{
-				LOC_stPinCFG.enmPinConf = PORT_enumInputInternalPullUp;						/*set the pin configuration as input Pull up*/
+				LOC_astPinsCFG[LOC_Switch].enmPinConf = PORT_enumInputInternalPullUp;		/*set the pin configuration as input Pull up*/
 			}
 			else
 			{
-				LOC_stPinCFG.enmPinConf = PORT_enumInputExternalPullDown;					/*set the pin configuration as input Pull Down*/
-			}
-			LOC_enuErrorStatus = PORT_enmSetCfg(&LOC_stPinCFG);								/*set the port configuration*/
-			if(LOC_enuErrorStatus == PORT_enmPortInvalid)									/*check if the port in not valid*/
-			{
-				RET_enuErrorStatus = SWITCH_enuInvalidPort;									/*return the port which configured is invalid*/
-				LOC_bExit			= TRUE;													/*exit the loop*/
-			}
-			else if(LOC_enuErrorStatus == PORT_enmPinNumOutOfRange)
-			{	
-				RET_enuErrorStatus	= SWITCH_enuInvalidPin;									/*return the port which configured is invalid*/
-				LOC_bExit			= TRUE;													/*exit the loop*/
-			}
-			else
-			{
-				/*No thing*/
+				LOC_astPinsCFG[LOC_Switch].enmPinConf = PORT_enumInputExternalPullDown;		/*set the pin configuration as input Pull Down*/
 			}
 		}
 		
 	}
+	if(!LOC_bExit)
+	{
+		LOC_enuErrorStatus = PORT_enmSetCfgBatch(LOC_astPinsCFG,NUMBER_OF_SWITCHS);			/*set all switches together*/
+		if(LOC_enuErrorStatus == PORT_enmPortInvalid)										/*check if the port in not valid*/
+		{
+			RET_enuErrorStatus = SWITCH_enuInvalidPort;										/*return the port which configured is invalid*/
+		}
+		else if(LOC_enuErrorStatus == PORT_enmPinNumOutOfRange)
+		{	
+			RET_enuErrorStatus	= SWITCH_enuInvalidPin;										/*return the port which configured is invalid*/
+		}
+		else
+		{
+			/*No thing*/
+		}
+	}
 	return RET_enuErrorStatus;																/*the function return*/
 }
 
@@ -194,9 +194,10 @@ static const uint8_t DecodeEachDigitTo7Seg[NUM_OF_NUMS_CAN_BE_DIS] =
 SEG7_enuErrors_t SEG7_enmInit(void)
 {
 	SEG7_enuErrors_t RET_enmErrorStatus = SEG7_enmOK;						/*return of the function which initialized with No problem */				
-	PORT_enmError_t LOC_enmErrorStatus = PORT_enmOk;						/*return of function PORT_enmSetCfg which initialized with No problem*/
+	PORT_enmError_t LOC_enmErrorStatus = PORT_enmOk;						/*return of function PORT_enmSetCfgBatch which initialized with No problem*/
 	boolean LOC_bExit					= FALSE;							/*to exit the function in found any configuration problem*/
-	PORT_stPortCfg_t LOC_stPinCFG = {0};									/*used by port to configure each pin in 7-segment*/
+	PORT_stPortCfg_t LOC_astPinsCFG[NUMBER_OF_7_SEGMENTS * NUM_OF_PINS_IN_EACH_7_SEG] = {0};	/*used by port to configure all pins together*/
+	uint8_t LOC_u8Entry = 0;												/*the next free entry in the pins table*/
 	for(uint8_t LOC_u87Seg = 0 ; LOC_u87Seg < NUMBER_OF_7_SEGMENTS && !LOC_bExit ; ++LOC_u87Seg)	/*loop in each 7-segment*/
 	{
 		/*Validation*/
@@ -208,30 +209,30 @@ SEG7_enuErrors_t SEG7_enmInit(void)
 		}
 		else
 		{
-			LOC_stPinCFG.enmPinConf= ((SEG7_cast7SegsCFG[LOC_u87Seg].enm7SegType == SEG7_enmAnode)?		/*to make all LEDs in 7-segments low*/
-			PORT_enmOutputHigh:PORT_enmOutputLOW);
-			for(uint8_t LOC_u8Pin = 0 ; LOC_u8Pin < NUM_OF_PINS_IN_EACH_7_SEG && !LOC_bExit; ++LOC_u8Pin )	/*loop in each pin for the each 7-segment*/
+			for(uint8_t LOC_u8Pin = 0 ; LOC_u8Pin < NUM_OF_PINS_IN_EACH_7_SEG ; ++LOC_u8Pin )	/*loop in each pin for the each 7-segment*/
 			{
-				LOC_stPinCFG.enmPin	= SEG7_cast7SegsCFG[LOC_u87Seg].acenmSetPinCFG[LOC_u8Pin].enmPin;		/*init the configuration led for the port */
-				LOC_stPinCFG.enmPort	= SEG7_cast7SegsCFG[LOC_u87Seg].acenmSetPinCFG[LOC_u8Pin].enmPort;
-				LOC_enmErrorStatus = PORT_enmSetCfg(&LOC_stPinCFG);						/*Trying to set the pin configuration*/
-				if(LOC_enmErrorStatus == PORT_enmPortInvalid)							/*check if the port is invalid*/
-				{
-					RET_enmErrorStatus = SEG7_enmInvalidPort;							/*return invalid status*/
-					LOC_bExit = TRUE;													/*will exit the the init process*/
-				}
-				else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)					/*check if the pin out of valid range */
-				{
-					RET_enmErrorStatus = SEG7_enmInvalidPin;							/*return the pin is not valid*/
-					LOC_bExit = TRUE;													/*exit the init process*/
-				}
-				else
-				{
-					/*Do nothing*/
-				}
+				LOC_astPinsCFG[LOC_u8Entry].enmPinConf = ((SEG7_cast7SegsCFG[LOC_u87Seg].enm7SegType == SEG7_enmAnode)?	/*to make all LEDs in 7-segments low*/
+				PORT_enmOutputHigh:PORT_enmOutputLOW);
+				LOC_astPinsCFG[LOC_u8Entry].enmPin	= SEG7_cast7SegsCFG[LOC_u87Seg].acenmSetPinCFG[LOC_u8Pin].enmPin;	/*init the configuration led for the port */
+				LOC_astPinsCFG[LOC_u8Entry].enmPort	= SEG7_cast7SegsCFG[LOC_u87Seg].acenmSetPinCFG[LOC_u8Pin].enmPort;
+				LOC_u8Entry++;
 			}
-
-			
+		}
+	}
+	if(!LOC_bExit)
+	{
+		LOC_enmErrorStatus = PORT_enmSetCfgBatch(LOC_astPinsCFG,LOC_u8Entry);		/*Trying to set all pins together*/
+		if(LOC_enmErrorStatus == PORT_enmPortInvalid)							/*check if the port is invalid*/
+		{
+			RET_enmErrorStatus = SEG7_enmInvalidPort;							/*return invalid status*/
+		}
+		else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)					/*check if the pin out of valid range */
+		{
+			RET_enmErrorStatus = SEG7_enmInvalidPin;							/*return the pin is not valid*/
+		}
+		else
+		{
+			/*Do nothing*/
 		}
 	}
 	u16MaxDisplayableNum = power(10,NUMBER_OF_7_SEGMENTS) - 1;								/*to calculate the max number can be displayed*/
@@ -245,10 +246,11 @@ SEG7_enuErrors_t SEG7_enuSetValue(const uint8_t Copy_cu8SegName
 									, const uint8_t Copy_cu8Value)
 {
 	SEG7_enuErrors_t RET_enmErrorStatus = SEG7_enmOK;						/*return of the function which initialized with No problem */	
-	DIO_enumError_t LOC_enmErrorsStatus = DIO_enmOk;						/*return of function DIO_enumSetPin error.initialized with No problem  */
-	DIO_enmPortOPTS LOC_enuPort = SEG7_cast7SegsCFG[Copy_cu8SegName].acenmSetPinCFG[PINA].enmPort; /*save the port configuration for each pin*/
+	DIO_enumError_t LOC_enmErrorsStatus = DIO_enmOk;						/*return of function DIO_enumSetMasked error.initialized with No problem  */
 	SEG7_enm7SegType_t LOC_7SegType = SEG7_cast7SegsCFG[Copy_cu8SegName].enm7SegType;			   /*variable for 7-segment type*/
-	boolean LOC_bExit = FALSE;																	   /*to exit if is found any error in any pin*/
+	boolean LOC_bExit = FALSE;																	   /*to exit if is found any error in any port*/
+	uint8_t au8Mask[NUMBER_OF_PORTS]  = {0};														   /*the 7-segment pins in each port*/
+	uint8_t au8Value[NUMBER_OF_PORTS] = {0};														   /*the new state of the 7-segment pins in each port*/
 	/*Validation*/
 	if(Copy_cu8SegName >= NUM_OF_PINS_IN_EACH_7_SEG  || Copy_cu8SegName < ONE_7_SEG_ATTACHED)	/*Check if the Copy_cu8SegName is Not valid*/
 	{
@@ -264,15 +266,27 @@ SEG7_enuErrors_t SEG7_enuSetValue(const uint8_t Copy_cu8SegName
 	}
 	else
 	{
-		for(uint8_t LOC_u8Pin = 0 ; LOC_u8Pin < NUM_OF_PINS_IN_EACH_7_SEG && !LOC_bExit ; LOC_u8Pin++)			/*loop for each pin in 7-segment */
+		for(uint8_t LOC_u8Pin = 0 ; LOC_u8Pin < NUM_OF_PINS_IN_EACH_7_SEG ; LOC_u8Pin++)			/*loop for each pin in 7-segment */
 		{
 			DIO_enmLOutputPinState_t LOC_enuPinState = ((														/*to find the pin state*/
 			(LOC_7SegType == SEG7_enmAnode && !GET_BIT(DecodeEachDigitTo7Seg[Copy_cu8Value] , LOC_u8Pin)) ||
 			(LOC_7SegType == SEG7_enmCathode && GET_BIT(DecodeEachDigitTo7Seg[Copy_cu8Value] , LOC_u8Pin) ) 
 			 )?DIO_enumLogicHigh : DIO_enumLogicLow);
-			 LOC_enuPort = SEG7_cast7SegsCFG[Copy_cu8SegName].acenmSetPinCFG[LOC_u8Pin].enmPort;				/*the pin port*/
-			 LOC_enmErrorsStatus = DIO_enumSetPin(LOC_enuPort,LOC_u8Pin,LOC_enuPinState);						/*set the pin state*/
-			if(LOC_enmErrorsStatus == DIO_enmPinIsInputNotOutput)						/*if the DIO_enumSetPin Failed to set the pin*/
+			PORT_enmPortOPTS_t LOC_enuPort = SEG7_cast7SegsCFG[Copy_cu8SegName].acenmSetPinCFG[LOC_u8Pin].enmPort;	/*the pin port*/
+			PORT_enumPins_t LOC_enuPin = SEG7_cast7SegsCFG[Copy_cu8SegName].acenmSetPinCFG[LOC_u8Pin].enmPin;		/*the pin number in the port*/
+			au8Mask[LOC_enuPort] |= (1 << LOC_enuPin);														/*collect the pin in its port*/
+			if(LOC_enuPinState == DIO_enumLogicHigh)
+			{
+				au8Value[LOC_enuPort] |= (1 << LOC_enuPin);
+			}
+		}
+		for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < NUMBER_OF_PORTS && !LOC_bExit ; LOC_u8Port++)				/*all segments of each port change together*/
+		{
+			if(au8Mask[LOC_u8Port] != 0)
+			{
+				LOC_enmErrorsStatus = DIO_enumSetMasked(LOC_u8Port,au8Mask[LOC_u8Port],au8Value[LOC_u8Port]);	/*set the pins state*/
+			}
+			if(LOC_enmErrorsStatus == DIO_enmPinIsInputNotOutput)						/*if the DIO_enumSetMasked Failed to set the pins*/
 			{
 				RET_enmErrorStatus = SEG7_enmConfiguredInputInAnotherModule;			/*The pin is INPUT not OUTPUT*/
 				LOC_bExit = TRUE;														/*exit the loop and return the error*/
@@ -83,44 +83,44 @@ const SEG7_st7SegCFG_t SEG7_cast7SegsCFG[NUMBER_OF_7_SEGMENTS] =
 		{
 			[PINA] =
 			{
-				.enmPort = PORT_enmPortC, 
-				.enmPin  = PORT_enumPin1
+				.enmPort = FIRST_7_SEG_PORT, 
+				.enmPin  = FIRST_7_SEG_PINA
 			}
 			,
 			[PINB] =
 			{
-				.enmPort = PORT_enmPortC,
-				.enmPin  = PORT_enumPin2
+				.enmPort = FIRST_7_SEG_PORT,
+				.enmPin  = FIRST_7_SEG_PINB
 			}
 			,
 			[PINC] =
 			{
-				.enmPort = PORT_enmPortC,
-				.enmPin  = PORT_enumPin3
+				.enmPort = FIRST_7_SEG_PORT,
+				.enmPin  = FIRST_7_SEG_PINC
 			}
 			,
 			[PIND] =
 			{
-				.enmPort = PORT_enmPortC,
-				.enmPin  = PORT_enumPin4
+				.enmPort = FIRST_7_SEG_PORT,
+				.enmPin  = FIRST_7_SEG_PIND
 			}
 			,
 			[PINE] =
 			{
-				.enmPort = PORT_enmPortC,
-				.enmPin  = PORT_enumPin5	
+				.enmPort = FIRST_7_SEG_PORT,
+				.enmPin  = FIRST_7_SEG_PINE	
 			}
 			,
 			[PINF] = 
 			{
-				.enmPort = PORT_enmPortC,
-				.enmPin  = PORT_enumPin6
+				.enmPort = FIRST_7_SEG_PORT,
+				.enmPin  = FIRST_7_SEG_PINF
 			}
 			,
 			[PING] =
 			{
-				.enmPort = PORT_enmPortC,
-				.enmPin  = PORT_enumPin7
+				.enmPort = FIRST_7_SEG_PORT,
+				.enmPin  = FIRST_7_SEG_PING
 			}
 		}
 	} 
@@ -91,6 +91,30 @@ extern "C"
 #define PINDP									7
 #endif
 
+/**
+*@brief the port and the pin of each segment of the first 7 segment
+*	(PORT_NUM_PORTx and PORT_NUM_PINy).
+*/
+#define FIRST_7_SEG_PORT							PORT_NUM_PORTC
+#define FIRST_7_SEG_PINA							PORT_NUM_PIN1
+#define FIRST_7_SEG_PINB							PORT_NUM_PIN2
+#define FIRST_7_SEG_PINC							PORT_NUM_PIN3
+#define FIRST_7_SEG_PIND							PORT_NUM_PIN4
+#define FIRST_7_SEG_PINE							PORT_NUM_PIN5
+#define FIRST_7_SEG_PINF							PORT_NUM_PIN6
+#define FIRST_7_SEG_PING							PORT_NUM_PIN7
+
+/**
+*@brief the pins of all 7 segments in the port _P , add each 7 segment which you configure.
+*/
+#define SEG7_PINS(_P)								(PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PINA,_P) | \
+									 PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PINB,_P) | \
+									 PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PINC,_P) | \
+									 PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PIND,_P) | \
+									 PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PINE,_P) | \
+									 PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PINF,_P) | \
+									 PORT_PIN_BIT(FIRST_7_SEG_PORT,FIRST_7_SEG_PING,_P))
+
 
 /******************************************************************************/
 
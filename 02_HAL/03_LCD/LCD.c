@@ -32,6 +32,9 @@
 #include "LCD.h"
 #include "LCD_CFG.h"
 #include "../../00_LIB/BIT_MATH.h"
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI
+#include "../../01_MCAL/08_TWI/TWI.h"
+#endif
 #ifndef F_CPU
 #define		F_CPU             8000000UL
 #endif
@@ -54,22 +57,27 @@
 #define		 SET_DDRAM_ADD_CMD(ADD)	       (0x80 | ADD)
 
 /**
-*@brief refer to the the DDRAM Lines .
+*@brief refer to the the DDRAM Lines of one controller .
 * First Line:
 *
 *	Start Address: 0x00
-*	End Address: 0x0F
+*	End Address: 0x27
 *Second Line:
 *
 *	Start Address: 0x40
-*	End Address: 0x4F
+*	End Address: 0x67
 */
 #define		 NUMBER_OF_LINES	       2
 
 /**
-*@brief refer to the first bit in register.
+*@brief refer to the maximum number of rows in the supported panels.
+*/
+#define		 MAX_NUM_OF_ROWS	       4
+
+/**
+*@brief refer to the enable mask which selects all controllers.
 */
-#define		 FIRST_BIT		       0
+#define		 ALL_CONTROLLERS	       ((1 << LCD_CONTROLLERS) - 1)
 
 /**
 *@brief refer to Command will sent.
@@ -90,6 +98,39 @@
 *@brief used to set cursor in new address in CGRAM.
 */
 #define		SET_CGRAM_ADD_CMD(ADD)		(0x40 | ADD)
+
+/**
+*@brief refer to number of characters in each DDRAM line in two lines mode,
+*	the display shows only NUM_OF_COLS of them at a time.
+*/
+#define		DDRAM_LINE_LENGTH		40
+
+/**
+*@brief refer to number of pages which can be laid out side by side in DDRAM.
+*/
+#define		NUM_OF_PAGES			(DDRAM_ROW_SPAN / NUM_OF_COLS)
+
+/**
+*@brief refer to number of DDRAM cells owned by each row , rows 2 and 3 of the
+*	one controller 4 lines panels continue the first two DDRAM lines.
+*/
+#if NUM_OF_ROWS > NUMBER_OF_LINES && LCD_CONTROLLERS == 1
+#define		DDRAM_ROW_SPAN			NUM_OF_COLS
+#else
+#define		DDRAM_ROW_SPAN			DDRAM_LINE_LENGTH
+#endif
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI
+/**
+*@brief number of PCF8574 frames used to clock one nibble (E high then E low).
+*/
+#define		FRAMES_PER_NIBBLE		2
+
+/**
+*@brief the back light bit which is sent with every frame.
+*/
+#define		PCF_BACKLIGHT_MASK		(LCD_PCF_BACKLIGHT << LCD_PCF_BACKLIGHT_BIT)
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
@@ -98,6 +139,25 @@
 /* PRIVATE MACROS */
 /******************************************************************************/
 
+#if LCD_TRANSPORT != LCD_TRANSPORT_DIO && LCD_TRANSPORT != LCD_TRANSPORT_TWI
+	#error "LCD_TRANSPORT configuration is wrong"
+#endif
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI && LCD_DATE_MODE != FOUR_BIT_MODE
+	#error "the PCF8574 backpack only supports FOUR_BIT_MODE"
+#endif
+
+#if NUM_OF_ROWS > MAX_NUM_OF_ROWS || NUM_OF_COLS > DDRAM_LINE_LENGTH
+	#error "LCD dimension configuration is wrong"
+#endif
+
+#if LCD_CONTROLLERS != 1 && LCD_CONTROLLERS != 2
+	#error "LCD_CONTROLLERS configuration is wrong"
+#endif
+
+#if LCD_CONTROLLERS == 2 && (LCD_TRANSPORT != LCD_TRANSPORT_DIO || NUM_OF_ROWS != MAX_NUM_OF_ROWS)
+	#error "two controllers are used only with 4 rows panels on the DIO transport"
+#endif
 
 /******************************************************************************/
 /* PRIVATE ENUMS */
@@ -136,7 +196,33 @@ static uint8_t u8CursorRow = 0;
 /**
 *@brief this array refer to the first address in each line in DDRAM.
 */
-static const uint8_t au8LCDLinesBaseAdd[NUMBER_OF_LINES] =  {0x00 , 0x40};
+#if LCD_CONTROLLERS == 1
+static const uint8_t au8LCDLinesBaseAdd[MAX_NUM_OF_ROWS] =  {0x00 , 0x40 , 0x00 + NUM_OF_COLS , 0x40 + NUM_OF_COLS};
+#else
+static const uint8_t au8LCDLinesBaseAdd[MAX_NUM_OF_ROWS] =  {0x00 , 0x40 , 0x00 , 0x40};
+
+/**
+*@brief this array refer to the Enable pin of each controller.
+*/
+static const uint8_t au8EnablePins[LCD_CONTROLLERS] = {E , E2};
+#endif
+
+/**
+*@brief used to know which controllers receive the next transfer (bit for each controller).
+*/
+static uint8_t u8EnableMask = 1;
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_DIO
+/**
+*@brief the data , RS and RW pins in each port , they are written together.
+*/
+static uint8_t au8BusMask[NUMBER_OF_PORTS];
+#endif
+
+/**
+*@brief a copy of the visible DDRAM cells , used to write only the changed cells.
+*/
+static uint8_t au8Shadow[NUM_OF_ROWS][NUM_OF_COLS];
 
 /**
 *@brief used to make internal command are allowed to sent.
@@ -150,6 +236,26 @@ static boolean bAllowCMD = TRUE;
     static uint8_t u8ConfFlag = 1;	
 #endif 
 
+/**
+*@brief used to know how many columns the display window is shifted to the left.
+*/
+static uint8_t u8DisplayShift = 0;
+
+/**
+*@brief used to know if the marquee is running.
+*/
+static volatile boolean bMarqueeOn = FALSE;
+
+/**
+*@brief set by the timer tick , the step is sent by LCD_vMarqueeDispatch.
+*/
+static volatile boolean bMarqueeStep = FALSE;
+
+/**
+*@brief the shift command which sent each marquee step.
+*/
+static uint8_t u8MarqueeCmd = SHIFT_DISPLAY_LEFT;
+
 boolean CGRAM = FALSE;
 /******************************************************************************/
 
@@ -167,6 +273,13 @@ boolean CGRAM = FALSE;
 *@brief refer to the configuration in LCF_CFG.h which you configured.
 */
 extern const LCD_stPinCFG_t astLCD_CFG[NUM_PINS];
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI
+/**
+*@brief refer to the TWI handle of the PCF8574 backpack in LCD_CFG.c.
+*/
+extern TWI_HandleTypeDef LCD_stTWIHandle;
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
@@ -178,6 +291,43 @@ extern const LCD_stPinCFG_t astLCD_CFG[NUM_PINS];
 */
 static LCD_enuErrorStatus enuCheckBoundry(void);
 
+/**
+*@brief used to prepare the transport which carries the LCD bus.
+*	DIO transport : configure the LCD pins as outputs.
+*	TWI transport : initialize TWI and check that the backpack acknowledges.
+*
+*@return error status.
+*/
+static LCD_enuErrorStatus enuTransportInit(void);
+
+/**
+*@brief used to direct the next transfers to the controller which owns the row.
+*
+*@param[in] Copy_u8Row refer to the row.
+*
+*@return no thing.
+*/
+static void vSelectRow(uint8_t Copy_u8Row);
+
+/**
+*@brief used to write a text in DDRAM starting from any column of the line,
+*	even the columns which are out of the display window.
+*
+*@param[in] Copy_u8Row refer to the line.
+*
+*@param[in] Copy_u8Col refer to the first column in DDRAM line.
+*
+*@param[in] Copy_pchText refer to the text , the rest of the field is filled by spaces.
+*
+*@param[in] Copy_u8Length refer to the text length.
+*
+*@param[in] Copy_u8Field refer to the number of DDRAM cells which will be written.
+*
+*@return no thing.
+*/
+static void vWriteField(uint8_t Copy_u8Row, uint8_t Copy_u8Col, const char* Copy_pchText,
+			uint8_t Copy_u8Length, uint8_t Copy_u8Field);
+
 /**
 *@brief used to write data or command in all LCD mode(8-bit or 4-bit).
 *
@@ -210,18 +360,18 @@ static LCD_enuErrorStatus enuCheckBoundry(void)
 
 	/*check if the display is full*/
 
-	if(u8CursorCol >= NUM_OF_COLS && u8CursorRow >= NUM_OF_ROWS)
+	if(u8CursorCol >= NUM_OF_COLS && u8CursorRow + 1 >= NUM_OF_ROWS)
 	{
 		RET_enoErrorStatus = LCD_enuDisplayIsFull;
 	}
 
-	/*check if the row is full and will move the cursor to the next row.*/
+	/*check if the row is full and will move the cursor to the next row.
+	  the next row is not the next DDRAM address in 4 lines panels so the
+	  address must be set again.*/
 	else if(u8CursorCol >= NUM_OF_COLS)
 	{
-		u8CursorRow++;
-		u8CursorCol = 0;
 		/*change the cursor to the first place in the new row.*/
-		LCD_enuGotoDDRAM_XY(u8CursorRow,u8CursorCol);
+		LCD_enuGotoDDRAM_XY(u8CursorRow + 1,0);
 	}
 	else
 	{
@@ -231,6 +381,81 @@ static LCD_enuErrorStatus enuCheckBoundry(void)
 	return RET_enoErrorStatus;
 }
 
+static void vSelectRow(uint8_t Copy_u8Row)
+{
+#if LCD_CONTROLLERS == 2
+	/*rows 0,1 belong to the first controller and rows 2,3 to the second*/
+	u8EnableMask = 1 << (Copy_u8Row / NUMBER_OF_LINES);
+#else
+	(void)Copy_u8Row;
+#endif
+}
+
+static void vWriteField(uint8_t Copy_u8Row, uint8_t Copy_u8Col, const char* Copy_pchText,
+			uint8_t Copy_u8Length, uint8_t Copy_u8Field)
+{
+	/*move the address counter to the first cell of the field*/
+	vSelectRow(Copy_u8Row);
+	vSetPins(CMD,SET_DDRAM_ADD_CMD((au8LCDLinesBaseAdd[Copy_u8Row] + Copy_u8Col)));
+
+	/*the address counter increases by itself after each write*/
+	for(uint8_t LOC_u8Cell = 0 ; LOC_u8Cell < Copy_u8Field ; LOC_u8Cell++)
+	{
+		uint8_t LOC_u8Char = (LOC_u8Cell < Copy_u8Length) ? Copy_pchText[LOC_u8Cell] : ' ';
+		vSetPins(DATA,LOC_u8Char);
+		/*keep the copy of the visible cells right*/
+		if(Copy_u8Col + LOC_u8Cell < NUM_OF_COLS)
+		{
+			au8Shadow[Copy_u8Row][Copy_u8Col + LOC_u8Cell] = LOC_u8Char;
+		}
+	}
+
+	/*return the cursor to the start of the line to keep the virtual cursor right*/
+	LCD_enuGotoDDRAM_XY(Copy_u8Row,0);
+}
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_DIO
+
+static LCD_enuErrorStatus enuTransportInit(void)
+{
+    LCD_enuErrorStatus RET_enmErrorStatus = LCD_enuOK;
+    PORT_enmError_t LOC_enmErrorStatus = PORT_enmOk;
+    /*the configuration of all used pins , applied together*/
+    PORT_stPortCfg_t astCFG[NUM_PINS] = {0};
+    uint8_t LOC_u8Entry = 0;
+    /*to configure the pins*/
+    uint8_t LOC_u8St = (LCD_DATE_MODE == EIGHT_BIT_MODE)?D0:D4; 
+    for (uint8_t LOC_u8Pin = LOC_u8St ; LOC_u8Pin < NUM_PINS ; LOC_u8Pin++)
+    {
+	  astCFG[LOC_u8Entry].enmPin  = astLCD_CFG[LOC_u8Pin].enmPin;
+	  astCFG[LOC_u8Entry].enmPort = astLCD_CFG[LOC_u8Pin].enmPort;
+	  astCFG[LOC_u8Entry].enmPinConf = PORT_enmOutputLOW;
+	  LOC_u8Entry++;
+    }
+    LOC_enmErrorStatus = PORT_enmSetCfgBatch(astCFG,LOC_u8Entry);
+	if(LOC_enmErrorStatus == PORT_enmPortInvalid)			/*check if the port is invalid*/
+	{
+		RET_enmErrorStatus = LCD_enmInvalidPort;		/*return invalid status*/
+	}
+	else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)		/*check if the pin out of valid range */
+	{
+		RET_enmErrorStatus = LCD_enmInvalidPin;			/*return the pin is not valid*/
+	}
+	else
+	{
+		/*collect the bus pins of each port*/
+		for (uint8_t LOC_u8Pin = LOC_u8St ; LOC_u8Pin < NUM_PINS ; LOC_u8Pin++)
+		{
+			if(LOC_u8Pin <= D7 || LOC_u8Pin == RS || LOC_u8Pin == RW)
+			{
+				au8BusMask[astLCD_CFG[LOC_u8Pin].enmPort] |= (1 << astLCD_CFG[LOC_u8Pin].enmPin);
+			}
+		}
+	}
+    /*the returned value.*/
+    return RET_enmErrorStatus;
+}
+
 static void vSetPins(boolean Copy_bRS,uint8_t Copy_u8Data)
 {
 	uint8_t LOC_u8Data = Copy_u8Data;
@@ -245,59 +470,118 @@ static void vSetPins(boolean Copy_bRS,uint8_t Copy_u8Data)
     #else
 	#error "LCD_DATA_MODE configuration is wrong"
     #endif
-    /*set data in the wires*/
+    /*the new state of the bus pins in each port , RW is always low*/
+    uint8_t au8BusValue[NUMBER_OF_PORTS] = {0};
     for(uint8_t LOC_u8Pin = LOC_u8Start ; LOC_u8Pin <= D7 ; LOC_u8Pin++)
     {
-	DIO_enumSetPin(astLCD_CFG[LOC_u8Pin].enmPort ,
-	astLCD_CFG[LOC_u8Pin].enmPin ,
-	GET_BIT(LOC_u8Data,LOC_u8Pin));
+	if(GET_BIT(LOC_u8Data,LOC_u8Pin))
+	{
+	    au8BusValue[astLCD_CFG[LOC_u8Pin].enmPort] |= (1 << astLCD_CFG[LOC_u8Pin].enmPin);
+	}
+    }
+    if(Copy_bRS)
+    {
+	au8BusValue[astLCD_CFG[RS].enmPort] |= (1 << astLCD_CFG[RS].enmPin);
+    }
+    /*set data , RS and RW in the wires , one write for each port*/
+    for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < NUMBER_OF_PORTS ; LOC_u8Port++)
+    {
+	if(au8BusMask[LOC_u8Port] != 0)
+	{
+	    DIO_enumSetMasked(LOC_u8Port,au8BusMask[LOC_u8Port],au8BusValue[LOC_u8Port]);
+	}
     }
     /*execute the command*/
-    DIO_enumSetPin(astLCD_CFG[RW].enmPort,astLCD_CFG[RW].enmPin,DIO_enumLogicLow);
-    DIO_enumSetPin(astLCD_CFG[RS].enmPort,astLCD_CFG[RS].enmPin,(!Copy_bRS)?DIO_enumLogicLow:DIO_enumLogicHigh);
-    DIO_enumSetPin(astLCD_CFG[E].enmPort,astLCD_CFG[E].enmPin,DIO_enumLogicHigh);
+    #if LCD_CONTROLLERS == 1
+    DIO_vSetPinFast(astLCD_CFG[E].enmPort,astLCD_CFG[E].enmPin);
+    _delay_ms(1);
+    DIO_vClrPinFast(astLCD_CFG[E].enmPort,astLCD_CFG[E].enmPin);
+    #else
+    /*strobe all selected controllers together , they latch the same bus*/
+    for(uint8_t LOC_u8Ctrl = 0 ; LOC_u8Ctrl < LCD_CONTROLLERS ; LOC_u8Ctrl++)
+    {
+	if(GET_BIT(u8EnableMask,LOC_u8Ctrl))
+	{
+	    DIO_vSetPinFast(astLCD_CFG[au8EnablePins[LOC_u8Ctrl]].enmPort,astLCD_CFG[au8EnablePins[LOC_u8Ctrl]].enmPin);
+	}
+    }
     _delay_ms(1);
-    DIO_enumSetPin(astLCD_CFG[E].enmPort,astLCD_CFG[E].enmPin,DIO_enumLogicLow);
+    for(uint8_t LOC_u8Ctrl = 0 ; LOC_u8Ctrl < LCD_CONTROLLERS ; LOC_u8Ctrl++)
+    {
+	DIO_vClrPinFast(astLCD_CFG[au8EnablePins[LOC_u8Ctrl]].enmPort,astLCD_CFG[au8EnablePins[LOC_u8Ctrl]].enmPin);
+    }
+    #endif
     #if LCD_DATE_MODE == FOUR_BIT_MODE
        }
     #endif 
-} 
-/******************************************************************************/
-/* PUBLIC FUNCTION DEFINITIONS */
-/******************************************************************************/
+}
 
+#elif LCD_TRANSPORT == LCD_TRANSPORT_TWI
 
-LCD_enuErrorStatus LCD_init(void)
+static LCD_enuErrorStatus enuTransportInit(void)
 {
-    LCD_enuErrorStatus RET_enmErrorStatus = LCD_enuOK;
-    PORT_enmError_t LOC_enmErrorStatus = PORT_enmOk;
-    PORT_stPortCfg_t stCFG = {0};
-    /*used to exit if wrong configuration detected*/		
-    boolean LOC_bExit = FALSE;
-    /*to configure the pins*/
-    uint8_t LOC_u8St = (LCD_DATE_MODE == EIGHT_BIT_MODE)?D0:D4; 
-    for (uint8_t LOC_u8Pin = LOC_u8St ; LOC_u8Pin < NUM_PINS && !LOC_bExit ; LOC_u8Pin++)
-    {
-	  stCFG.enmPin  = astLCD_CFG[LOC_u8Pin].enmPin;
-	  stCFG.enmPort = astLCD_CFG[LOC_u8Pin].enmPort;
-	  stCFG.enmPinConf = PORT_enmOutputLOW;
-	 LOC_enmErrorStatus = PORT_enmSetCfg(&stCFG);
-	if(LOC_enmErrorStatus == PORT_enmPortInvalid)			/*check if the port is invalid*/
+	LCD_enuErrorStatus RET_enmErrorStatus = LCD_enuOK;
+	/*all backpack outputs low except the back light*/
+	uint8_t LOC_u8Frame = PCF_BACKLIGHT_MASK;
+
+	/*the backpack must acknowledge its address otherwise it is not connected*/
+	if(TWI_Init(&LCD_stTWIHandle) != TWI_OK ||
+	   TWI_Master_Transmit(&LCD_stTWIHandle , LCD_PCF8574_ADDRESS , &LOC_u8Frame , 1 , LCD_TWI_TIMEOUT) != TWI_OK)
 	{
-		RET_enmErrorStatus = LCD_enmInvalidPort;		/*return invalid status*/
-		LOC_bExit = TRUE;					/*will exit the the init process*/
+		RET_enmErrorStatus = LCD_enuTransportFailed;
 	}
-	else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)		/*check if the pin out of valid range */
+	else
 	{
-		RET_enmErrorStatus = LCD_enmInvalidPin;			/*return the pin is not valid*/
-		LOC_bExit = TRUE;					/*exit the init process*/
+		/*Do nothing*/
+	}
+	/*the returned value.*/
+	return RET_enmErrorStatus;
+}
+
+static void vSetPins(boolean Copy_bRS,uint8_t Copy_u8Data)
+{
+	/*each nibble is clocked by two frames so one byte needs four frames*/
+	uint8_t au8Frames[2 * FRAMES_PER_NIBBLE];
+	/*number of frames which will be sent in this burst*/
+	uint8_t LOC_u8Frames = 0;
+	/*RS and the back light are the same in all frames of the burst , RW is always low*/
+	uint8_t LOC_u8Ctrl = PCF_BACKLIGHT_MASK | ((!Copy_bRS) ? 0 : (1 << LCD_PCF_RS_BIT));
+
+	for(uint8_t LOC_SendTwice = 0 ; LOC_SendTwice < u8ConfFlag +1 ; LOC_SendTwice++)
+	{
+		/*the upper nibble is always the one on the wires*/
+		uint8_t LOC_u8Nibble = RIGHT_SHIFT((uint8_t)LEFT_SHIFT(Copy_u8Data , LOC_SendTwice * 4) , 4);
+		uint8_t LOC_u8Frame  = LOC_u8Ctrl | (LOC_u8Nibble << LCD_PCF_D4_BIT);
+
+		/*the LCD latches the nibble on the falling edge of E*/
+		au8Frames[LOC_u8Frames++] = LOC_u8Frame | (1 << LCD_PCF_E_BIT);
+		au8Frames[LOC_u8Frames++] = LOC_u8Frame;
+	}
+	/*one START , one address and all frames , the transfer itself covers the E pulse width*/
+	TWI_Master_Transmit(&LCD_stTWIHandle , LCD_PCF8574_ADDRESS , au8Frames , LOC_u8Frames , LCD_TWI_TIMEOUT);
+
+	/*clear display and return home take 1.52 ms , longer than the next burst*/
+	if(Copy_bRS == CMD && (Copy_u8Data == DISPLY_CLEAR || Copy_u8Data == RETURN_HOME_CMD))
+	{
+		_delay_ms(2);
 	}
 	else
 	{
 		/*Do nothing*/
 	}
-    }
-    if(LOC_bExit == FALSE)
+}
+
+#endif
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+
+LCD_enuErrorStatus LCD_init(void)
+{
+    /*prepare the transport before any command is sent*/
+    LCD_enuErrorStatus RET_enmErrorStatus = enuTransportInit();
+    if(RET_enmErrorStatus == LCD_enuOK)
     {
 	    /*the initialization of LCD */
 	    #if LCD_DATE_MODE == FOUR_BIT_MODE
@@ -333,13 +617,21 @@ LCD_enuErrorStatus LCD_init(void)
 LCD_enuErrorStatus LCD_enuWriteData(uint8_t Copy_u8Data)
 {
 	/*check if the boundary have a space to write the new character.*/
-	LCD_enuErrorStatus RET_enuErrorStatus = LCD_enuOK;
+	LCD_enuErrorStatus RET_enuErrorStatus = enuCheckBoundry();
 
 	/*if we have a place to write the new character.*/
-	if(RET_enuErrorStatus == LCD_enuOK)
+	if(RET_enuErrorStatus == LCD_enuOK && CGRAM == TRUE)
+	{
+		/*special patterns must exist in all controllers*/
+		u8EnableMask = ALL_CONTROLLERS;
+		vSetPins(DATA,Copy_u8Data);
+		vSelectRow(u8CursorRow);
+	}
+	else if(RET_enuErrorStatus == LCD_enuOK)
 	{
-		/*print it and increase the column by one*/
+		/*print it , keep its copy and increase the column by one*/
 		vSetPins(DATA,Copy_u8Data);
+		au8Shadow[u8CursorRow][u8CursorCol] = Copy_u8Data;
 		u8CursorCol++;
 	}
 	else
@@ -372,9 +664,42 @@ LCD_enuErrorStatus LCD_enuWriteCommand(uint8_t Copy_u8Command)
 		{
 			u8CursorRow = 0;
 			u8CursorCol = 0;
+			/*the cleared display is filled by spaces*/
+			for(uint8_t LOC_u8Row = 0 ; LOC_u8Row < NUM_OF_ROWS ; LOC_u8Row++)
+			{
+				for(uint8_t LOC_u8Col = 0 ; LOC_u8Col < NUM_OF_COLS ; LOC_u8Col++)
+				{
+					au8Shadow[LOC_u8Row][LOC_u8Col] = ' ';
+				}
+			}
+		}
+		/**
+		* Clear Display and Return Home commands return the display to its original position.
+		*/
+		if(Copy_u8Command == DISPLY_CLEAR || Copy_u8Command == RETURN_HOME_CMD)
+		{
+			u8DisplayShift = 0;
+		}
+		else if(Copy_u8Command == SHIFT_DISPLAY_LEFT)
+		{
+			u8DisplayShift = (u8DisplayShift + 1) % DDRAM_LINE_LENGTH;
+		}
+		else if(Copy_u8Command == SHIFT_DISPLAY_RIGHT)
+		{
+			u8DisplayShift = (u8DisplayShift + DDRAM_LINE_LENGTH - 1) % DDRAM_LINE_LENGTH;
+		}
+		else
+		{
+			/*No thing*/
+		}
+		/*only DDRAM address commands belong to one controller , the others go to all*/
+		if(GET_BIT(Copy_u8Command,7) == 0)
+		{
+			u8EnableMask = ALL_CONTROLLERS;
 		}
 		/*send the command*/
 		vSetPins(CMD,Copy_u8Command);
+		vSelectRow(u8CursorRow);
 	}
 	
 	/*the returned value*/
@@ -392,18 +717,14 @@ LCD_enuErrorStatus LCD_enuGotoDDRAM_XY(uint8_t Copy_u8X, uint8_t Copy_u8Y)
 	}
 	else
 	{
-		/*the base address of the line in DDRAM*/
-		uint8_t LOC_u8BaseAdd = au8LCDLinesBaseAdd[GET_BIT(Copy_u8X,FIRST_BIT)];
-
-		/*the offset which added to the base address to get the right address.*/
-		uint8_t LOC_u8Offset  = ((Copy_u8X > 1) ? (20 + Copy_u8Y): (Copy_u8Y));
-
-		/*the actual address in DDRAM*/
-		uint8_t LOC_u8DDRAMAdd = LOC_u8BaseAdd + LOC_u8Offset;
+		/*the actual address in DDRAM , the base address of the row comes from the panel geometry*/
+		uint8_t LOC_u8DDRAMAdd = au8LCDLinesBaseAdd[Copy_u8X] + Copy_u8Y;
 
 		/*update the cursor location*/
 		u8CursorRow = Copy_u8X;
 		u8CursorCol = Copy_u8Y;
+		/*the address belongs to the controller of the new row , select it before the command*/
+		vSelectRow(Copy_u8X);
 		/*allow this command to sent , and sent it to LCD.*/
 		bAllowCMD = FALSE;
 		LCD_enuWriteCommand(SET_DDRAM_ADD_CMD(LOC_u8DDRAMAdd));
@@ -543,4 +864,226 @@ LCD_enuErrorStatus LCD_enuDisplaySpecialPattern(uint8_t* ADD_pu8Pattern, uint8_t
 	return RET_enuErrorStatus;
 }
 
-/******************************************************************************/
\ No newline at end of file
+LCD_enuErrorStatus LCD_enuLoadLine(uint8_t Copy_u8Row, const char* Copy_pchText, uint8_t Copy_u8Length)
+{
+	/*refer to the function returned value*/
+	LCD_enuErrorStatus RET_enuErrorStatus = LCD_enuOK;
+
+	/*check if the row is not valid*/
+	if(Copy_u8Row >= NUM_OF_ROWS)
+	{
+		RET_enuErrorStatus = LCD_enuNotValidPositionInDDRAM;
+	}
+	/*check if the DDRAM line have a place for the text*/
+	else if(Copy_u8Length > DDRAM_ROW_SPAN)
+	{
+		RET_enuErrorStatus = LCD_enuRowNotEnough;
+	}
+	/*check if the parameter not equal null*/
+	else if(Copy_pchText == NULL)
+	{
+		RET_enuErrorStatus = LCD_enuNullPtr;
+	}
+	else
+	{
+		/*fill the whole DDRAM line once , the marquee only shifts it later*/
+		vWriteField(Copy_u8Row,0,Copy_pchText,Copy_u8Length,DDRAM_ROW_SPAN);
+	}
+	/*return the error status*/
+	return RET_enuErrorStatus;
+}
+
+LCD_enuErrorStatus LCD_enuLoadPage(uint8_t Copy_u8Page, uint8_t Copy_u8Row,
+				   const char* Copy_pchText, uint8_t Copy_u8Length)
+{
+	/*refer to the function returned value*/
+	LCD_enuErrorStatus RET_enuErrorStatus = LCD_enuOK;
+
+	/*check if the page is not valid*/
+	if(Copy_u8Page >= NUM_OF_PAGES)
+	{
+		RET_enuErrorStatus = LCD_enuWrongPage;
+	}
+	/*check if the row is not valid*/
+	else if(Copy_u8Row >= NUM_OF_ROWS)
+	{
+		RET_enuErrorStatus = LCD_enuNotValidPositionInDDRAM;
+	}
+	/*check if the page row have a place for the text*/
+	else if(Copy_u8Length > NUM_OF_COLS)
+	{
+		RET_enuErrorStatus = LCD_enuRowNotEnough;
+	}
+	/*check if the parameter not equal null*/
+	else if(Copy_pchText == NULL)
+	{
+		RET_enuErrorStatus = LCD_enuNullPtr;
+	}
+	else
+	{
+		/*each page owns NUM_OF_COLS cells of the DDRAM line*/
+		vWriteField(Copy_u8Row,Copy_u8Page * NUM_OF_COLS,Copy_pchText,Copy_u8Length,NUM_OF_COLS);
+	}
+	/*return the error status*/
+	return RET_enuErrorStatus;
+}
+
+LCD_enuErrorStatus LCD_enuShowPage(uint8_t Copy_u8Page)
+{
+	/*refer to the function returned value*/
+	LCD_enuErrorStatus RET_enuErrorStatus = LCD_enuOK;
+
+	/*check if the page is not valid*/
+	if(Copy_u8Page >= NUM_OF_PAGES)
+	{
+		RET_enuErrorStatus = LCD_enuWrongPage;
+	}
+	else
+	{
+		/*the page is a still screen*/
+		bMarqueeOn = FALSE;
+		bMarqueeStep = FALSE;
+
+		/*number of left shifts needed to bring the page into the window*/
+		uint8_t LOC_u8Left = (Copy_u8Page * NUM_OF_COLS + DDRAM_LINE_LENGTH - u8DisplayShift) % DDRAM_LINE_LENGTH;
+
+		/*DDRAM lines are circular so take the shorter direction*/
+		if(LOC_u8Left <= DDRAM_LINE_LENGTH / 2)
+		{
+			while(LOC_u8Left--)
+			{
+				LCD_enuWriteCommand(SHIFT_DISPLAY_LEFT);
+			}
+		}
+		else
+		{
+			for(uint8_t LOC_u8Right = DDRAM_LINE_LENGTH - LOC_u8Left ; LOC_u8Right > 0 ; LOC_u8Right--)
+			{
+				LCD_enuWriteCommand(SHIFT_DISPLAY_RIGHT);
+			}
+		}
+	}
+	/*return the error status*/
+	return RET_enuErrorStatus;
+}
+
+LCD_enuErrorStatus LCD_enuStartMarquee(LCD_enuScrollDirection Copy_enuDirection)
+{
+	/*refer to the function returned value*/
+	LCD_enuErrorStatus RET_enuErrorStatus = LCD_enuOK;
+
+	if(Copy_enuDirection == LCD_enuScrollLeft)
+	{
+		u8MarqueeCmd = SHIFT_DISPLAY_LEFT;
+		bMarqueeOn = TRUE;
+	}
+	else if(Copy_enuDirection == LCD_enuScrollRight)
+	{
+		u8MarqueeCmd = SHIFT_DISPLAY_RIGHT;
+		bMarqueeOn = TRUE;
+	}
+	else
+	{
+		RET_enuErrorStatus = LCD_enuNotValidCmd;
+	}
+	/*return the error status*/
+	return RET_enuErrorStatus;
+}
+
+void LCD_vStopMarquee(void)
+{
+	bMarqueeOn = FALSE;
+	bMarqueeStep = FALSE;
+}
+
+void LCD_vMarqueeTick(void* pvParam)
+{
+	(void)pvParam;
+	/*it runs in the timer interrupt , the command is sent from the main loop*/
+	if(bMarqueeOn == TRUE)
+	{
+		bMarqueeStep = TRUE;
+	}
+	else
+	{
+		/*No thing*/
+	}
+}
+
+void LCD_vMarqueeDispatch(void)
+{
+	/*each animation step is only one command byte , the steps which came
+	  while the main loop was busy are one step*/
+	if(bMarqueeStep == TRUE)
+	{
+		bMarqueeStep = FALSE;
+		if(bMarqueeOn == TRUE)
+		{
+			LCD_enuWriteCommand(u8MarqueeCmd);
+		}
+	}
+	else
+	{
+		/*No thing*/
+	}
+}
+
+LCD_enuErrorStatus LCD_enuUpdateString(uint8_t Copy_u8X, uint8_t Copy_u8Y,
+				       const char* Copy_pchPattern, uint8_t Copy_u8Length)
+{
+	/*refer to the function returned value*/
+	LCD_enuErrorStatus RET_enuErrorStatus = LCD_enuOK;
+
+	/*check if the position is not valid.*/
+	if(Copy_u8X >= NUM_OF_ROWS || Copy_u8Y >= NUM_OF_COLS)
+	{
+		RET_enuErrorStatus = LCD_enuNotValidPositionInDDRAM;
+	}
+	/*check if the row have a place to display the string*/
+	else if(Copy_u8Length + Copy_u8Y > NUM_OF_COLS)
+	{
+		RET_enuErrorStatus = LCD_enuRowNotEnough;
+	}
+	/*check if the parameter not equal null*/
+	else if(Copy_pchPattern == NULL)
+	{
+		RET_enuErrorStatus = LCD_enuNullPtr;
+	}
+	else
+	{
+		/*the column which the address counter points to , NUM_OF_COLS means unknown*/
+		uint8_t LOC_u8AddCounter = NUM_OF_COLS;
+
+		for(uint8_t LOC_u8Ch = 0 ; LOC_u8Ch < Copy_u8Length ; LOC_u8Ch++)
+		{
+			uint8_t LOC_u8Col = Copy_u8Y + LOC_u8Ch;
+
+			/*write only the cells which changed*/
+			if(au8Shadow[Copy_u8X][LOC_u8Col] != (uint8_t)Copy_pchPattern[LOC_u8Ch])
+			{
+				/*the address is set only after skipping unchanged cells*/
+				if(LOC_u8AddCounter != LOC_u8Col)
+				{
+					LCD_enuGotoDDRAM_XY(Copy_u8X,LOC_u8Col);
+				}
+				LCD_enuWriteData(Copy_pchPattern[LOC_u8Ch]);
+				LOC_u8AddCounter = LOC_u8Col + 1;
+			}
+		}
+
+		/*leave the cursor after the string like LCD_enuWriteString*/
+		if(LOC_u8AddCounter != Copy_u8Y + Copy_u8Length && Copy_u8Y + Copy_u8Length < NUM_OF_COLS)
+		{
+			LCD_enuGotoDDRAM_XY(Copy_u8X,Copy_u8Y + Copy_u8Length);
+		}
+		else
+		{
+			u8CursorRow = Copy_u8X;
+			u8CursorCol = Copy_u8Y + Copy_u8Length;
+		}
+	}
+	/*return the error status*/
+	return RET_enuErrorStatus;
+}
+
+/******************************************************************************/
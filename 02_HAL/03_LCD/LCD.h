@@ -157,9 +157,37 @@ typedef enum
     /**
     *@brief returned if you want to write in invalid CGRAM block.
     */
-    LCD_enuWrongCGRAM_Block
+    LCD_enuWrongCGRAM_Block ,
+
+    /**
+    *@brief returned if the transport (the I2C backpack) did not respond.
+    */
+    LCD_enuTransportFailed ,
+
+    /**
+    *@brief returned if you want to use a page which does not exist in DDRAM.
+    */
+    LCD_enuWrongPage
 
 } LCD_enuErrorStatus;
+
+/*
+*@brief the direction of the marquee.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief the text moves to the left.
+    */
+    LCD_enuScrollLeft ,
+
+    /**
+    *@brief the text moves to the right.
+    */
+    LCD_enuScrollRight
+
+} LCD_enuScrollDirection;
 /******************************************************************************/
 
 /******************************************************************************/
@@ -265,6 +293,103 @@ LCD_enuErrorStatus LCD_enuDisplaySpecialPattern(uint8_t* Copy_pu8Pattern,
 						uint8_t Copy_u8CGRAMBlockNumber,
 						uint8_t Copy_u8X,
 						uint8_t Copy_u8Y);
+
+/**
+*@brief		used to load a whole DDRAM line (up to 40 characters) once,
+*		the part out of the display window is shown by the marquee.
+*
+*@param[in]	Copy_u8Row : describe the row which you choose in LCD.
+*
+*@param[in]	Copy_pchText : the text , the rest of the line is filled by spaces.
+*
+*@param[in]	Copy_u8Length : the length of the provided text.
+*
+*@return	it will return error status.
+*/
+LCD_enuErrorStatus LCD_enuLoadLine(uint8_t Copy_u8Row, const char* Copy_pchText, uint8_t Copy_u8Length);
+
+/**
+*@brief		used to lay out one row of a page , pages are placed side by side
+*		in DDRAM so (40 / NUM_OF_COLS) pages are available.
+*
+*@param[in]	Copy_u8Page : the page number starting from 0.
+*
+*@param[in]	Copy_u8Row : describe the row which you choose in LCD.
+*
+*@param[in]	Copy_pchText : the text , the rest of the page row is filled by spaces.
+*
+*@param[in]	Copy_u8Length : the length of the provided text.
+*
+*@return	it will return error status.
+*/
+LCD_enuErrorStatus LCD_enuLoadPage(uint8_t Copy_u8Page, uint8_t Copy_u8Row,
+				   const char* Copy_pchText, uint8_t Copy_u8Length);
+
+/**
+*@brief		used to show a page which loaded before by shifting the display
+*		, no data is written. it stops the marquee.
+*
+*@param[in]	Copy_u8Page : the page number starting from 0.
+*
+*@return	it will return error status.
+*/
+LCD_enuErrorStatus LCD_enuShowPage(uint8_t Copy_u8Page);
+
+/**
+*@brief		used to start the marquee , all rows move together.
+*
+*@param[in]	Copy_enuDirection : the direction of the marquee.
+*
+*@return	it will return error status.
+*/
+LCD_enuErrorStatus LCD_enuStartMarquee(LCD_enuScrollDirection Copy_enuDirection);
+
+/**
+*@brief		used to stop the marquee at its current position.
+*
+*@return	None.
+*/
+void LCD_vStopMarquee(void);
+
+/**
+*@brief		used to request one step of the marquee , it has the timer call
+*		back signature so it can be passed to Timer_enuSetCallBack.
+*
+*@param[in]	pvParam : not used.
+*
+*@return	None.
+*
+*@note		it only marks the step , nothing is sent to the LCD from the
+*		interrupt.
+*/
+void LCD_vMarqueeTick(void* pvParam);
+
+/**
+*@brief		used to send the requested marquee step , it is called from the
+*		main loop so the shift command never interrupts another LCD API.
+*		EX:- while(1) { LCD_vMarqueeDispatch(); ... }
+*
+*@return	None.
+*/
+void LCD_vMarqueeDispatch(void);
+
+/**
+*@brief		used to update a part of a row , only the characters which differ
+*		from the displayed ones are sent so status screens are updated
+*		without clearing them.
+*
+*@param[in]	Copy_u8X : describe the row which you choose in LCD.
+*
+*@param[in]	Copy_u8Y : describe the column which you choose in LCD.
+*
+*@param[in]	Copy_pchPattern : the new string.
+*
+*@param[in]	Copy_u8Length : the length of the provided string.
+*
+*@return	it will return error status.
+*/
+LCD_enuErrorStatus LCD_enuUpdateString(uint8_t Copy_u8X, uint8_t Copy_u8Y,
+				       const char* Copy_pchPattern, uint8_t Copy_u8Length);
 /******************************************************************************/
 
 /******************************************************************************/
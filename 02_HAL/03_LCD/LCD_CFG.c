@@ -21,6 +21,9 @@
 /******************************************************************************/
 #include "../../01_MCAL/01_PORT/PORT.h"
 #include "LCD_CFG.h"
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI
+#include "../../01_MCAL/08_TWI/TWI.h"
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
@@ -80,70 +83,96 @@ const LCD_stPinCFG_t astLCD_CFG[NUM_PINS] =
 {	
 	[D0] =
 	{
-	     .enmPin  = PORT_enumPin1,
-	     .enmPort = PORT_enmPortA
+	     .enmPin  = LCD_D0_PIN,
+	     .enmPort = LCD_D0_PORT
 	}                                                                    
 	,
 	[D1] =
 	{
-	       .enmPin = PORT_enumPin2,
-		.enmPort = PORT_enmPortA
+	       .enmPin = LCD_D1_PIN,
+		.enmPort = LCD_D1_PORT
 	}
 	,
 	[D2] =
 	{
-		.enmPin  = PORT_enumPin3,
-		.enmPort = PORT_enmPortA
+		.enmPin  = LCD_D2_PIN,
+		.enmPort = LCD_D2_PORT
 	}
 	,
 	[D3] =
 	{
-		.enmPin  = PORT_enumPin4,
-		.enmPort = PORT_enmPortA
+		.enmPin  = LCD_D3_PIN,
+		.enmPort = LCD_D3_PORT
 	}
 	,
 	[D4] =
 	{
-		.enmPin  = PORT_enumPin5,
-		.enmPort = PORT_enmPortA
+		.enmPin  = LCD_D4_PIN,
+		.enmPort = LCD_D4_PORT
 	}
 	,
 	[D5] =
 	{
-		.enmPin  = PORT_enumPin6,
-		.enmPort = PORT_enmPortB
+		.enmPin  = LCD_D5_PIN,
+		.enmPort = LCD_D5_PORT
 	}
 	,
 	[D6] =
 	{
-		.enmPin  = PORT_enumPin5,
-		.enmPort = PORT_enmPortB
+		.enmPin  = LCD_D6_PIN,
+		.enmPort = LCD_D6_PORT
 	}
 	,
 	[D7] =
 	{
-		.enmPin  = PORT_enumPin1,
-		.enmPort = PORT_enmPortB
+		.enmPin  = LCD_D7_PIN,
+		.enmPort = LCD_D7_PORT
 	}
 	,
 	[E] =
 	{
-		.enmPin  = PORT_enumPin2,
-		.enmPort = PORT_enmPortB
+		.enmPin  = LCD_E_PIN,
+		.enmPort = LCD_E_PORT
 	}
 	,
 	[RW] =
 	{
-		.enmPin  = PORT_enumPin3,
-		.enmPort = PORT_enmPortB
+		.enmPin  = LCD_RW_PIN,
+		.enmPort = LCD_RW_PORT
 	}
 	,
 	[RS] =
 	{
-		.enmPin  = PORT_enumPin4,
-		.enmPort = PORT_enmPortB
+		.enmPin  = LCD_RS_PIN,
+		.enmPort = LCD_RS_PORT
+	}
+#if LCD_CONTROLLERS == 2
+	,
+	[E2] =
+	{
+		.enmPin  = LCD_E2_PIN,
+		.enmPort = LCD_E2_PORT
+	}
+#endif
+};
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI
+/**
+* @brief TWI handle of the PCF8574 backpack , the PCF8574 is limited to 100 kHz
+*	so the prescaler is chosen to keep SCL below it.
+*/
+TWI_HandleTypeDef LCD_stTWIHandle =
+{
+	.Init =
+	{
+		.Prescaler		   = TWI_PRESCALLER_16,
+		.SCLFrequency		   = 100000,
+		.GeneralCallRecogantioon   = TWI_GeneralCall_Disable,
+		.OwnAddress		   = 0,
+		.interrupt		   = TWI_Interrupt_Disable
 	}
 };
+#endif
 /******************************************************************************/
 
 /******************************************************************************/
@@ -48,10 +48,20 @@ extern "C"
 /*			        LCD dimension			              */
 /******************************************************************************/
 
+/**
+*@brief the dimension of the display , supported panels are 16x2 , 20x2 , 16x4 ,
+*	20x4 and 40x4.
+*/
 #define			NUM_OF_ROWS				2
 
 #define			NUM_OF_COLS				16
 
+/**
+*@brief number of HD44780 controllers in the panel , 40x4 panels have two
+*	controllers (rows 0,1 and rows 2,3) and each one has its own E pin.
+*/
+#define			LCD_CONTROLLERS				1
+
 
 
 
@@ -78,6 +88,58 @@ extern "C"
 
 
 
+/******************************************************************************/
+/*			   LCD TRANSPORT CONFIGURATION	                      */
+/******************************************************************************/
+
+/**
+*@brief used if the LCD pins are wired directly to the micro-controller pins.
+*/
+#define			LCD_TRANSPORT_DIO			0
+
+/**
+*@brief used if the LCD is driven through a PCF8574 I2C backpack.
+*	the backpack only wires D4..D7 so LCD_DATE_MODE must be FOUR_BIT_MODE.
+*/
+#define			LCD_TRANSPORT_TWI			1
+
+/**
+*@brief the transport which you want to apply you must choose only
+*	LCD_TRANSPORT_DIO or LCD_TRANSPORT_TWI !!
+*/
+#define			LCD_TRANSPORT				LCD_TRANSPORT_DIO
+
+/**
+*@brief the 7-bit TWI address of the PCF8574 (0x20..0x27) or PCF8574A (0x38..0x3F).
+*/
+#define			LCD_PCF8574_ADDRESS			0x27
+
+/**
+*@brief the timeout passed to TWI_Master_Transmit for each burst.
+*/
+#define			LCD_TWI_TIMEOUT				1000
+
+/**
+*@brief the PCF8574 bit which drives each LCD line (the common backpack wiring).
+*/
+#define			LCD_PCF_RS_BIT				0
+#define			LCD_PCF_RW_BIT				1
+#define			LCD_PCF_E_BIT				2
+#define			LCD_PCF_BACKLIGHT_BIT			3
+
+/**
+*@brief the PCF8574 bit which drives D4 , D5..D7 are the next three bits.
+*/
+#define			LCD_PCF_D4_BIT				4
+
+/**
+*@brief used to determine the back light state : 1 to turn it on , 0 to turn it off.
+*/
+#define			LCD_PCF_BACKLIGHT			1
+
+
+
+
 /*****************************************************************************/
 /*			   LCD CHARACHTER FONTS				     */
 /*****************************************************************************/
@@ -217,6 +279,64 @@ extern "C"
 */
 #define			RS					10
 
+/**
+*@brief refer to the Enable pin of the second controller (used only if LCD_CONTROLLERS is 2).
+*/
+#define			E2					11
+
+
+/**
+*@brief the port and the pin of each LCD pin (PORT_NUM_PORTx and PORT_NUM_PINy).
+*/
+#define			LCD_D0_PORT				PORT_NUM_PORTA
+#define			LCD_D0_PIN				PORT_NUM_PIN1
+#define			LCD_D1_PORT				PORT_NUM_PORTA
+#define			LCD_D1_PIN				PORT_NUM_PIN2
+#define			LCD_D2_PORT				PORT_NUM_PORTA
+#define			LCD_D2_PIN				PORT_NUM_PIN3
+#define			LCD_D3_PORT				PORT_NUM_PORTA
+#define			LCD_D3_PIN				PORT_NUM_PIN4
+#define			LCD_D4_PORT				PORT_NUM_PORTA
+#define			LCD_D4_PIN				PORT_NUM_PIN5
+#define			LCD_D5_PORT				PORT_NUM_PORTB
+#define			LCD_D5_PIN				PORT_NUM_PIN6
+#define			LCD_D6_PORT				PORT_NUM_PORTB
+#define			LCD_D6_PIN				PORT_NUM_PIN5
+#define			LCD_D7_PORT				PORT_NUM_PORTB
+#define			LCD_D7_PIN				PORT_NUM_PIN1
+#define			LCD_E_PORT					PORT_NUM_PORTB
+#define			LCD_E_PIN					PORT_NUM_PIN2
+#define			LCD_RW_PORT				PORT_NUM_PORTB
+#define			LCD_RW_PIN				PORT_NUM_PIN3
+#define			LCD_RS_PORT				PORT_NUM_PORTB
+#define			LCD_RS_PIN				PORT_NUM_PIN4
+#define			LCD_E2_PORT				PORT_NUM_PORTB
+#define			LCD_E2_PIN				PORT_NUM_PIN8
+
+/**
+*@brief the pins which the LCD drives in the port _P , the PCF8574 backpack
+*	uses the TWI pins only.
+*/
+#if LCD_TRANSPORT == LCD_TRANSPORT_TWI
+#define			LCD_PINS(_P)				0
+#else
+#if LCD_DATE_MODE == EIGHT_BIT_MODE
+#define			LCD_LOW_DATA_PINS(_P)			(PORT_PIN_BIT(LCD_D0_PORT,LCD_D0_PIN,_P) | PORT_PIN_BIT(LCD_D1_PORT,LCD_D1_PIN,_P) | \
+							 PORT_PIN_BIT(LCD_D2_PORT,LCD_D2_PIN,_P) | PORT_PIN_BIT(LCD_D3_PORT,LCD_D3_PIN,_P))
+#else
+#define			LCD_LOW_DATA_PINS(_P)			0
+#endif
+#if LCD_CONTROLLERS == 2
+#define			LCD_E2_PINS(_P)				PORT_PIN_BIT(LCD_E2_PORT,LCD_E2_PIN,_P)
+#else
+#define			LCD_E2_PINS(_P)				0
+#endif
+#define			LCD_PINS(_P)				(LCD_LOW_DATA_PINS(_P) | \
+							 PORT_PIN_BIT(LCD_D4_PORT,LCD_D4_PIN,_P) | PORT_PIN_BIT(LCD_D5_PORT,LCD_D5_PIN,_P) | \
+							 PORT_PIN_BIT(LCD_D6_PORT,LCD_D6_PIN,_P) | PORT_PIN_BIT(LCD_D7_PORT,LCD_D7_PIN,_P) | \
+							 PORT_PIN_BIT(LCD_E_PORT,LCD_E_PIN,_P)   | PORT_PIN_BIT(LCD_RW_PORT,LCD_RW_PIN,_P) | \
+							 PORT_PIN_BIT(LCD_RS_PORT,LCD_RS_PIN,_P) | LCD_E2_PINS(_P))
+#endif
 
 
 
@@ -227,7 +347,7 @@ extern "C"
 /**
 *@brief this represent the number of pins in LCD.
 */
-#define			NUM_PINS				11
+#define			NUM_PINS				(11 + LCD_CONTROLLERS - 1)
 
 /*******************************************************************************/
 
@@ -29,6 +29,7 @@
 #include "Keypad_CFG.h"
 #include "../../01_MCAL/00_DIO/DIO.h"
 #include "../../01_MCAL/01_PORT/PORT.h"
+#include "../../00_LIB/BIT_MATH.h"
 /******************************************************************************/
 
 /******************************************************************************/
@@ -113,8 +114,8 @@ KEYPAD_enuErrors_t KEYPAD_enuInit(void)
 	/*it is the return of the function it contain the error status of the function.*/
 	KEYPAD_enuErrors_t RET_enuErrorStatus = KEYBAD_enuOK;
 	
-	/*used to configure the pin port and its number. */
-	PORT_stPortCfg_t LOC_stPinCFG		= {0};				
+	/*used to configure the port and the number of all rows and columns together. */
+	PORT_stPortCfg_t LOC_astPinsCFG[KEYPAD_ROWS + KEYPAD_COLS] = {0};
 
 	/*used in for loop and pointer to each row to configure all rows in keypad.*/
 	uint8_t LOC_u8Row = 0;
@@ -123,16 +124,13 @@ KEYPAD_enuErrors_t KEYPAD_enuInit(void)
 	for(LOC_u8Row = 0 ; LOC_u8Row < KEYPAD_ROWS ; LOC_u8Row++)
 	{	
 		/*refer to the pin row number which is configured before*/
-		LOC_stPinCFG.enmPin = KEYPAD_CFG_stCFG[LOC_u8Row].enmPin;
+		LOC_astPinsCFG[LOC_u8Row].enmPin = KEYPAD_CFG_stCFG[LOC_u8Row].enmPin;
 
 		/*refer to the port of the row which is configured before*/
-		LOC_stPinCFG.enmPort = KEYPAD_CFG_stCFG[LOC_u8Row].enmPort;
+		LOC_astPinsCFG[LOC_u8Row].enmPort = KEYPAD_CFG_stCFG[LOC_u8Row].enmPort;
 
 		/*configure the row as input pull-up*/
-		LOC_stPinCFG.enmPinConf = PORT_enumInputInternalPullUp;
-
-		/*configure the row and return the error status from the port.*/
-		RET_enuErrorStatus = PORT_enmSetCfg(&LOC_stPinCFG);
+		LOC_astPinsCFG[LOC_u8Row].enmPinConf = PORT_enumInputInternalPullUp;
 	}
 	
 	/*used in for loop and pointer to each column to configure all rows in keypad.*/
@@ -142,18 +140,18 @@ KEYPAD_enuErrors_t KEYPAD_enuInit(void)
 	for(LOC_u8Col ; LOC_u8Col < (KEYPAD_ROWS + KEYPAD_COLS) ; LOC_u8Col++)
 	{
 		/*refer to the pin column number which is configured before*/
-		LOC_stPinCFG.enmPin = KEYPAD_CFG_stCFG[LOC_u8Col].enmPin;
+		LOC_astPinsCFG[LOC_u8Col].enmPin = KEYPAD_CFG_stCFG[LOC_u8Col].enmPin;
 
 		/*refer to the port of the column which is configured before*/
-		LOC_stPinCFG.enmPort = KEYPAD_CFG_stCFG[LOC_u8Col].enmPort;
+		LOC_astPinsCFG[LOC_u8Col].enmPort = KEYPAD_CFG_stCFG[LOC_u8Col].enmPort;
 
 		/*configure the column as output high*/
-		LOC_stPinCFG.enmPinConf = PORT_enmOutputHigh;
-
-		/*configure the row and return the error status from the port.*/
-		RET_enuErrorStatus = PORT_enmSetCfg(&LOC_stPinCFG);
+		LOC_astPinsCFG[LOC_u8Col].enmPinConf = PORT_enmOutputHigh;
 	}
 
+	/*configure all rows and columns together and return the error status from the port.*/
+	RET_enuErrorStatus = PORT_enmSetCfgBatch(LOC_astPinsCFG,KEYPAD_ROWS + KEYPAD_COLS);
+
 	/*to return the error status*/
 	return RET_enuErrorStatus;
 }
@@ -171,8 +169,15 @@ KEYPAD_enuErrors_t KEYPAD_enuGetKey(uint8_t * ADD_pChar)
 	}
 	else
 	{
-		/*this variable contains the status of the row if it high or low*/
-		uint8_t LOC_u8RowStatus = 1;
+		/*this array contains the state of each port , read once for each column*/
+		uint8_t au8PortState[NUMBER_OF_PORTS] = {0};
+
+		/*this array contains the row pins in each port*/
+		uint8_t au8RowsMask[NUMBER_OF_PORTS] = {0};
+		for(uint8_t LOC_u8Row = 0 ; LOC_u8Row < KEYPAD_ROWS ; LOC_u8Row++)
+		{
+			au8RowsMask[KEYPAD_CFG_stCFG[LOC_u8Row].enmPort] |= (1 << KEYPAD_CFG_stCFG[LOC_u8Row].enmPin);
+		}
 
 		/*used in for loop and pointer to each column in keypad*/
 		uint8_t LOC_u8Col = KEYPAD_ROWS;
@@ -188,6 +193,15 @@ KEYPAD_enuErrors_t KEYPAD_enuGetKey(uint8_t * ADD_pChar)
 				       KEYPAD_CFG_stCFG[LOC_u8Col].enmPin,
 					DIO_enumLogicLow);
 			
+			/*sample all rows of each port together*/
+			for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < NUMBER_OF_PORTS ; LOC_u8Port++)
+			{
+				if(au8RowsMask[LOC_u8Port] != 0)
+				{
+					DIO_enumReadPort(LOC_u8Port,&au8PortState[LOC_u8Port]);
+				}
+			}
+
 			/*used in for loop and pointer to each row in keypad.*/
 			uint8_t LOC_u8Row = 0;
 
@@ -197,10 +211,7 @@ KEYPAD_enuErrors_t KEYPAD_enuGetKey(uint8_t * ADD_pChar)
 			 */
 			for(LOC_u8Row = 0 ; LOC_u8Row < KEYPAD_ROWS && !LOC_bIsBuPresed ; LOC_u8Row++)
 			{
-				DIO_enumGetState(KEYPAD_CFG_stCFG[LOC_u8Row].enmPort,
-						KEYPAD_CFG_stCFG[LOC_u8Row].enmPin,
-						 &LOC_u8RowStatus);
-				if(LOC_u8RowStatus == 0)
+				if(GET_BIT(au8PortState[KEYPAD_CFG_stCFG[LOC_u8Row].enmPort],KEYPAD_CFG_stCFG[LOC_u8Row].enmPin) == 0)
 				{
 					*ADD_pChar = Keypad_buttons[LOC_u8Row][LOC_u8Col % KEYPAD_COLS];
 					LOC_bIsBuPresed = TRUE;
@@ -76,50 +76,50 @@ const KEYPAD_stKeypadCFG_t KEYPAD_CFG_stCFG[KEYPAD_COLS + KEYPAD_ROWS] =
 {
 	[ROW1] = 
 	{
-		.enmPort = PORT_enmPortC,
-		.enmPin = PORT_enumPin1
+		.enmPort = ROW1_PORT,
+		.enmPin = ROW1_PIN
 	}
 	,
 	[ROW2] =
 	{
-		.enmPort = PORT_enmPortC ,
-		.enmPin = PORT_enumPin2 ,
+		.enmPort = ROW2_PORT ,
+		.enmPin = ROW2_PIN ,
 	}
 	,
 	[ROW3] =
 	{
-		.enmPort = PORT_enmPortC ,
-		.enmPin = PORT_enumPin3
+		.enmPort = ROW3_PORT ,
+		.enmPin = ROW3_PIN
 	}
 	,
 	[ROW4] =
 	{
-		.enmPort = PORT_enmPortC ,
-		.enmPin = PORT_enumPin4
+		.enmPort = ROW4_PORT ,
+		.enmPin = ROW4_PIN
 	}
 	,
 	[COL1] =
 	{
-		.enmPort = PORT_enmPortC,
-		.enmPin  = PORT_enumPin5
+		.enmPort = COL1_PORT,
+		.enmPin  = COL1_PIN
 	}
 	,
 	[COL2] =
 	{
-		.enmPort = PORT_enmPortC,
-		.enmPin  = PORT_enumPin6
+		.enmPort = COL2_PORT,
+		.enmPin  = COL2_PIN
 	}
 	,
 	[COL3] =
 	{
-		.enmPort = PORT_enmPortC,
-		.enmPin  = PORT_enumPin7
+		.enmPort = COL3_PORT,
+		.enmPin  = COL3_PIN
 	}
 	,
 	[COL4] =
 	{
-		.enmPort = PORT_enmPortC,
-		.enmPin  = PORT_enumPin8
+		.enmPort = COL4_PORT,
+		.enmPin  = COL4_PIN
 	}
 };
 
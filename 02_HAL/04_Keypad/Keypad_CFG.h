@@ -108,6 +108,39 @@ extern "C"
 #define			COL4						7
 
 
+/*******************************************************************************/
+/*                          The Keypad pins                                    */
+/*******************************************************************************/
+/**
+*@brief the port and the pin of each row and column (PORT_NUM_PORTx and PORT_NUM_PINy).
+*/
+#define			ROW1_PORT					PORT_NUM_PORTC
+#define			ROW1_PIN					PORT_NUM_PIN1
+#define			ROW2_PORT					PORT_NUM_PORTC
+#define			ROW2_PIN					PORT_NUM_PIN2
+#define			ROW3_PORT					PORT_NUM_PORTC
+#define			ROW3_PIN					PORT_NUM_PIN3
+#define			ROW4_PORT					PORT_NUM_PORTC
+#define			ROW4_PIN					PORT_NUM_PIN4
+
+#define			COL1_PORT					PORT_NUM_PORTC
+#define			COL1_PIN					PORT_NUM_PIN5
+#define			COL2_PORT					PORT_NUM_PORTC
+#define			COL2_PIN					PORT_NUM_PIN6
+#define			COL3_PORT					PORT_NUM_PORTC
+#define			COL3_PIN					PORT_NUM_PIN7
+#define			COL4_PORT					PORT_NUM_PORTC
+#define			COL4_PIN					PORT_NUM_PIN8
+
+/**
+*@brief the pins of the rows (inputs) and the columns (outputs) in the port _P.
+*/
+#define			KEYPAD_ROWS_PINS(_P)				(PORT_PIN_BIT(ROW1_PORT,ROW1_PIN,_P) | PORT_PIN_BIT(ROW2_PORT,ROW2_PIN,_P) | \
+							 PORT_PIN_BIT(ROW3_PORT,ROW3_PIN,_P) | PORT_PIN_BIT(ROW4_PORT,ROW4_PIN,_P))
+#define			KEYPAD_COLS_PINS(_P)				(PORT_PIN_BIT(COL1_PORT,COL1_PIN,_P) | PORT_PIN_BIT(COL2_PORT,COL2_PIN,_P) | \
+							 PORT_PIN_BIT(COL3_PORT,COL3_PIN,_P) | PORT_PIN_BIT(COL4_PORT,COL4_PIN,_P))
+
+
 /******************************************************************************/
 
 /******************************************************************************/
@@ -0,0 +1,463 @@
+/******************************************************************************/
+/**
+ * @file SWPWM.c
+ * @brief software PWM implementation for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * Implements a multi-channel software PWM with Binary Code Modulation (BCM).
+ * the PWM period is split into SWPWM_BITS slots , the slot of bit n is
+ * 2^n times the slot of bit 0 and in it every channel outputs bit n of its
+ * duty cycle. so each period has only SWPWM_BITS edges whatever the number
+ * of channels :
+ *  - the channels are grouped by port , each slot has a pre-computed image
+ *    for each used port and the interrupt writes it with one masked write.
+ *  - the slots longer than the 8-bit Timer2 are repeated , the repeated
+ *    interrupts don't touch the ports.
+ *  - the images are double buffered , a new set of duty cycles is swapped
+ *    in at the start of a period only.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "SWPWM.h"
+#include "SWPWM_CFG.h"
+#include "../../01_MCAL/00_DIO/DIO.h"
+#include "../../01_MCAL/01_PORT/PORT.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+#include "../../01_MCAL/03_Timers/Reg.h"
+#include "../../01_MCAL/02_Interrupt/ISR.h"
+#include "../../00_LIB/BIT_MATH.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the longest slot which Timer2 can count in one compare match , the
+*	longer slots are repeated.
+*/
+#define			SLOT_MAX_TICKS				128
+
+/**
+*@brief the largest duty cycle.
+*/
+#define			SWPWM_MAX_DUTY				((1 << SWPWM_BITS) - 1)
+
+/**
+*@brief   Timer/Counter2 compare match Interrupt Enable bit.
+*/
+#define			OCIE2					7
+
+/**
+*@brief   Timer/Counter2 CTC mode bit.
+*/
+#define			WGM21					3
+
+/**
+*@brief the counter and the compare register of Timer2 , volatile so the slot
+*	handler reads the counter after the compare value is written.
+*/
+#define			TCNT2_REG				*((volatile uint8_t *)0x44)
+#define			OCR2_REG				*((volatile uint8_t *)0x43)
+/******************************************************************************/
+
+#if TIMER2_ENABLE == ON
+#error Timer2 is used by the software PWM , set TIMER2_ENABLE to OFF.
+#endif
+
+#if SWPWM_BITS < 1 || SWPWM_BITS > 8
+#error SWPWM_BITS must be from 1 to 8.
+#endif
+
+#if SWPWM_CHANNELS < 1 || SWPWM_CHANNELS > (NUMBER_OF_PORTS * NUMBER_OF_PINS_IN_EACH_PORT)
+#error SWPWM_CHANNELS is configured in wrong way.
+#endif
+
+#if SWPWM_LSB_TICKS < 2 || SWPWM_LSB_TICKS > SLOT_MAX_TICKS || (SWPWM_LSB_TICKS & (SWPWM_LSB_TICKS - 1)) != 0
+#error SWPWM_LSB_TICKS must be a power of two from 2 to 128.
+#endif
+
+#if SWPWM_PRESCALER < SWPWM_PRESCALER_1 || SWPWM_PRESCALER > SWPWM_PRESCALER_1024
+#error SWPWM_PRESCALER is configured in wrong way.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the duty cycle of each channel.
+*/
+static uint8_t au8Duty[SWPWM_CHANNELS];
+
+/**
+*@brief the used ports , their number and the PWM pins in each one.
+*/
+static uint8_t au8UsedPorts[NUMBER_OF_PORTS];
+static uint8_t au8PortMask[NUMBER_OF_PORTS];
+static uint8_t u8UsedPorts = 0;
+
+/**
+*@brief the index of each channel in au8UsedPorts and its pin mask.
+*/
+static uint8_t au8ChannelPort[SWPWM_CHANNELS];
+static uint8_t au8ChannelMask[SWPWM_CHANNELS];
+
+/**
+*@brief the compare value of each slot and how many times it is repeated
+*	after the first compare match.
+*/
+static uint8_t au8SlotOCR[SWPWM_BITS];
+static uint8_t au8SlotRepeats[SWPWM_BITS];
+
+/**
+*@brief the two buffers of the ports images , one image for each slot and used port.
+*/
+static uint8_t au8Frames[2][SWPWM_BITS][NUMBER_OF_PORTS];
+
+/**
+*@brief the buffer which the interrupt outputs and the request to swap the buffers.
+*/
+static volatile uint8_t u8Active = 0;
+static volatile boolean bSwapPending = FALSE;
+
+/**
+*@brief the running slot and its remaining repeats.
+*/
+static uint8_t u8Slot = 0;
+static uint8_t u8RepeatsLeft = 0;
+
+/**
+*@brief the compare value of the next slot , it is ready before its interrupt.
+*/
+static uint8_t u8NextOCR = 0;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief contain the port and the pin of each channel.
+*/
+extern const SWPWM_stChannelCFG_t SWPWM_castChannelsCFG[SWPWM_CHANNELS];
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief outputs the next slot , called from the vector or the dispatcher.
+*/
+static void vSlotHandler(void * ADD_pvParam);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER2_COMP)
+/**
+* @brief timer2 compare interrupt service routine.
+*/
+void __vector_4(void) __attribute__((signal));
+#endif
+
+/**
+* @brief builds the images of the buffer which is not in use from au8Duty
+*	and requests the swap at the start of the next period.
+*/
+static void vBuildFrame(void);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static void vBuildFrame(void)
+{
+	/*no swap while the buffer is built , so the interrupt keeps the other one*/
+	bSwapPending = FALSE;
+	uint8_t LOC_u8Back = u8Active ^ 1;
+	for(uint8_t LOC_u8Bit = 0 ; LOC_u8Bit < SWPWM_BITS ; LOC_u8Bit++)
+	{
+		for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < u8UsedPorts ; LOC_u8Port++)
+		{
+			au8Frames[LOC_u8Back][LOC_u8Bit][LOC_u8Port] = 0;
+		}
+		for(uint8_t LOC_u8Channel = 0 ; LOC_u8Channel < SWPWM_CHANNELS ; LOC_u8Channel++)
+		{
+			if(GET_BIT(au8Duty[LOC_u8Channel],LOC_u8Bit))
+			{
+				au8Frames[LOC_u8Back][LOC_u8Bit][au8ChannelPort[LOC_u8Channel]] |= au8ChannelMask[LOC_u8Channel];
+			}
+		}
+	}
+	/*the interrupt swaps at the start of the next period*/
+	bSwapPending = TRUE;
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+SWPWM_enuErrors_t SWPWM_enuInit(void)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	SWPWM_enuErrors_t RET_enuErrorStatus = SWPWM_enuOK;
+
+	/*used to configure all channels pins together*/
+	PORT_stPortCfg_t LOC_astPinsCFG[SWPWM_CHANNELS] = {0};
+
+	for(uint8_t LOC_u8Channel = 0 ; LOC_u8Channel < SWPWM_CHANNELS ; LOC_u8Channel++)
+	{
+		LOC_astPinsCFG[LOC_u8Channel].enmPort    = SWPWM_castChannelsCFG[LOC_u8Channel].enmPort;
+		LOC_astPinsCFG[LOC_u8Channel].enmPin     = SWPWM_castChannelsCFG[LOC_u8Channel].enmPin;
+		LOC_astPinsCFG[LOC_u8Channel].enmPinConf = PORT_enmOutputLOW;
+	}
+
+	/*all pins are checked before any of them is changed*/
+	PORT_enmError_t LOC_enmErrorStatus = PORT_enmSetCfgBatch(LOC_astPinsCFG,SWPWM_CHANNELS);
+	if(LOC_enmErrorStatus == PORT_enmPortInvalid)
+	{
+		RET_enuErrorStatus = SWPWM_enuInvalidPort;
+	}
+	else if(LOC_enmErrorStatus == PORT_enmPinNumOutOfRange)
+	{
+		RET_enuErrorStatus = SWPWM_enuInvalidPin;
+	}
+	else
+	{
+		/*group the channels by port*/
+		u8UsedPorts = 0;
+		for(uint8_t LOC_u8Channel = 0 ; LOC_u8Channel < SWPWM_CHANNELS ; LOC_u8Channel++)
+		{
+			uint8_t LOC_u8Port = SWPWM_castChannelsCFG[LOC_u8Channel].enmPort;
+			uint8_t LOC_u8Idx  = 0;
+			while(LOC_u8Idx < u8UsedPorts && au8UsedPorts[LOC_u8Idx] != LOC_u8Port)
+			{
+				LOC_u8Idx++;
+			}
+			if(LOC_u8Idx == u8UsedPorts)
+			{
+				au8UsedPorts[LOC_u8Idx] = LOC_u8Port;
+				au8PortMask[LOC_u8Idx]  = 0;
+				u8UsedPorts++;
+			}
+			au8ChannelPort[LOC_u8Channel] = LOC_u8Idx;
+			au8ChannelMask[LOC_u8Channel] = (1 << SWPWM_castChannelsCFG[LOC_u8Channel].enmPin);
+			au8PortMask[LOC_u8Idx]       |= au8ChannelMask[LOC_u8Channel];
+			au8Duty[LOC_u8Channel]        = 0;
+		}
+
+		/*the slot of bit n is (SWPWM_LSB_TICKS << n) ticks , split in equal repeats if it is too long*/
+		for(uint8_t LOC_u8Bit = 0 ; LOC_u8Bit < SWPWM_BITS ; LOC_u8Bit++)
+		{
+			uint16_t LOC_u16Ticks = ((uint16_t)SWPWM_LSB_TICKS << LOC_u8Bit);
+			if(LOC_u16Ticks > SLOT_MAX_TICKS)
+			{
+				au8SlotOCR[LOC_u8Bit]     = SLOT_MAX_TICKS - 1;
+				au8SlotRepeats[LOC_u8Bit] = (LOC_u16Ticks / SLOT_MAX_TICKS) - 1;
+			}
+			else
+			{
+				au8SlotOCR[LOC_u8Bit]     = LOC_u16Ticks - 1;
+				au8SlotRepeats[LOC_u8Bit] = 0;
+			}
+		}
+
+		/*both buffers start with all channels low*/
+		vBuildFrame();
+		u8Active      = u8Active ^ 1;
+		bSwapPending  = FALSE;
+		u8Slot        = 0;
+		u8RepeatsLeft = au8SlotRepeats[0];
+		u8NextOCR     = au8SlotOCR[(SWPWM_BITS > 1) ? 1 : 0];
+
+		#if ISR_IS_DISPATCHED(ISR_VECT_TIMER2_COMP)
+		ISR_enuAttach(ISR_VECT_TIMER2_COMP,vSlotHandler,NULL);
+		#endif
+
+		/*Timer2 in CTC mode , the first slot is bit 0*/
+		TCNT2 = 0;
+		OCR2  = au8SlotOCR[0];
+		TCCR2 = (1 << WGM21) | SWPWM_PRESCALER;
+		SET_BIT(TIMSK,OCIE2);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+SWPWM_enuErrors_t SWPWM_enuSetDuty(uint8_t Copy_u8Channel, uint8_t Copy_u8Duty)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	SWPWM_enuErrors_t RET_enuErrorStatus = SWPWM_enuOK;
+
+	if(Copy_u8Channel >= SWPWM_CHANNELS)
+	{
+		RET_enuErrorStatus = SWPWM_enuInvalidChannel;
+	}
+	else if(Copy_u8Duty > SWPWM_MAX_DUTY)
+	{
+		RET_enuErrorStatus = SWPWM_enuInvalidDuty;
+	}
+	else
+	{
+		au8Duty[Copy_u8Channel] = Copy_u8Duty;
+		vBuildFrame();
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+SWPWM_enuErrors_t SWPWM_enuSetDuties(const uint8_t * ADD_pu8Duty)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	SWPWM_enuErrors_t RET_enuErrorStatus = SWPWM_enuOK;
+
+	if(ADD_pu8Duty == NULL)
+	{
+		RET_enuErrorStatus = SWPWM_enuNullPtr;
+	}
+	else
+	{
+		/*check all duty cycles first*/
+		for(uint8_t LOC_u8Channel = 0 ; LOC_u8Channel < SWPWM_CHANNELS ; LOC_u8Channel++)
+		{
+			if(ADD_pu8Duty[LOC_u8Channel] > SWPWM_MAX_DUTY)
+			{
+				RET_enuErrorStatus = SWPWM_enuInvalidDuty;
+			}
+		}
+		if(RET_enuErrorStatus == SWPWM_enuOK)
+		{
+			for(uint8_t LOC_u8Channel = 0 ; LOC_u8Channel < SWPWM_CHANNELS ; LOC_u8Channel++)
+			{
+				au8Duty[LOC_u8Channel] = ADD_pu8Duty[LOC_u8Channel];
+			}
+			vBuildFrame();
+		}
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+void SWPWM_vStop(void)
+{
+	/*stop the timer and its interrupt*/
+	CLR_BIT(TIMSK,OCIE2);
+	TCCR2 = 0;
+
+	/*drive all channels low*/
+	for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < u8UsedPorts ; LOC_u8Port++)
+	{
+		DIO_enumSetMasked(au8UsedPorts[LOC_u8Port],au8PortMask[LOC_u8Port],0);
+	}
+}
+
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER2_COMP)
+void __vector_4(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER2_COMP);
+	vSlotHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER2_COMP);
+}
+#endif
+
+static void vSlotHandler(void * ADD_pvParam)
+{
+	if(u8RepeatsLeft != 0)
+	{
+		/*the same slot is still running , no edge*/
+		u8RepeatsLeft--;
+	}
+	else
+	{
+		/*the counter is just cleared , the compare value of the new slot is
+		  written first so a short slot is not passed while the rest is done*/
+		OCR2_REG = u8NextOCR;
+		if(TCNT2_REG >= u8NextOCR)
+		{
+			/*the interrupt came late , the counter would wrap after 256 ticks
+			  so the slot ends at the next tick*/
+			TCNT2_REG = u8NextOCR - 1;
+		}
+
+		/*move to the next slot , the buffers are swapped at the start of a period only*/
+		u8Slot++;
+		if(u8Slot == SWPWM_BITS)
+		{
+			u8Slot = 0;
+			if(bSwapPending)
+			{
+				u8Active     = u8Active ^ 1;
+				bSwapPending = FALSE;
+			}
+		}
+		u8RepeatsLeft = au8SlotRepeats[u8Slot];
+
+		/*one masked write for each used port*/
+		const uint8_t * LOC_pu8Image = au8Frames[u8Active][u8Slot];
+		for(uint8_t LOC_u8Port = 0 ; LOC_u8Port < u8UsedPorts ; LOC_u8Port++)
+		{
+			DIO_vSetMaskedFast(au8UsedPorts[LOC_u8Port],au8PortMask[LOC_u8Port],LOC_pu8Image[LOC_u8Port]);
+		}
+
+		u8NextOCR = au8SlotOCR[(u8Slot == (SWPWM_BITS - 1)) ? 0 : (u8Slot + 1)];
+	}
+}
+
+/******************************************************************************/
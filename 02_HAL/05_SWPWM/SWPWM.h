@@ -0,0 +1,184 @@
+/******************************************************************************/
+/**
+ * @file SWPWM.h
+ * @brief software PWM API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for a
+ * multi-channel software PWM on any DIO pins. the channels are driven by
+ * Binary Code Modulation from the Timer2 compare match interrupt , each
+ * interrupt writes every used port once whatever the number of channels.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef SWPWM_H_
+#define SWPWM_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all software PWM errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     SWPWM_enuOK ,
+
+     /**
+     *@brief if you entered wrong port while configuration.
+     */
+     SWPWM_enuInvalidPort,
+
+     /**
+     *@brief if you entered wrong pin while configuration.
+     */
+     SWPWM_enuInvalidPin,
+
+     /**
+     *@brief if you entered a channel out of SWPWM_CHANNELS.
+     */
+     SWPWM_enuInvalidChannel,
+
+     /**
+     *@brief if you entered a duty cycle larger than (2^SWPWM_BITS - 1).
+     */
+     SWPWM_enuInvalidDuty,
+
+    /**
+    *@brief returned if you pass a null pointer to functions.
+    */
+     SWPWM_enuNullPtr
+
+} SWPWM_enuErrors_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief configures the channels pins as output low , builds the BCM slots
+ *	and starts Timer2 in CTC mode with its compare match interrupt.
+ *
+ * @return the software PWM error status.
+ *
+ * @note Timer2 is owned by this module , TIMER2_ENABLE must be OFF.
+ */
+SWPWM_enuErrors_t SWPWM_enuInit(void);
+
+/**
+ * @brief sets the duty cycle of one channel.
+ *
+ * @param[in] Copy_u8Channel	the channel (SWPWM_CH1 , SWPWM_CH2 ..).
+ *
+ * @param[in] Copy_u8Duty	the duty cycle from 0 (always low) to
+ *				(2^SWPWM_BITS - 1) (always high).
+ *
+ * @return the software PWM error status.
+ *
+ * @note the new duty cycle starts with the next PWM period , all channels
+ *	change together so there is no half updated period.
+ */
+SWPWM_enuErrors_t SWPWM_enuSetDuty(uint8_t Copy_u8Channel, uint8_t Copy_u8Duty);
+
+/**
+ * @brief sets the duty cycles of all channels with one update.
+ *
+ * @param[in] ADD_pu8Duty	array of SWPWM_CHANNELS duty cycles.
+ *
+ * @return the software PWM error status.
+ *
+ * @note nothing is changed if any duty cycle is wrong.
+ */
+SWPWM_enuErrors_t SWPWM_enuSetDuties(const uint8_t * ADD_pu8Duty);
+
+/**
+ * @brief stops Timer2 and drives all channels low.
+ */
+void SWPWM_vStop(void);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* SWPWM_H_ */
+/******************************************************************************/
@@ -0,0 +1,115 @@
+/******************************************************************************/
+/**
+ * @file SWPWM_CFG.c
+ * @brief the pins of the software PWM channels.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * contain the port and the pin of each software PWM channel , the channels
+ * which share a port are written together.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "SWPWM_CFG.h"
+#include "../../00_LIB/Platform_Types.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the port and the pin of each channel.
+*/
+const SWPWM_stChannelCFG_t SWPWM_castChannelsCFG[SWPWM_CHANNELS] =
+{
+	[SWPWM_CH1] =
+	{
+		.enmPort = SWPWM_CH1_PORT,
+		.enmPin  = SWPWM_CH1_PIN
+	}
+	,
+	[SWPWM_CH2] =
+	{
+		.enmPort = SWPWM_CH2_PORT,
+		.enmPin  = SWPWM_CH2_PIN
+	}
+};
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
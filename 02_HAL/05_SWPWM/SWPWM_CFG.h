@@ -0,0 +1,184 @@
+/*******************************************************************************/
+/**
+* @file SWPWM_CFG.h
+* @brief Header file for software PWM configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the software PWM module which
+* drives any DIO pins from the Timer2 compare match interrupt using Binary
+* Code Modulation (BCM).
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef SWPWM_CFG_H_
+#define SWPWM_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../01_MCAL/01_PORT/PORT.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   SWPWM Configurations		                      */
+/******************************************************************************/
+
+/**
+*@brief the number of the PWM channels , each channel is one DIO pin.
+*/
+#define			SWPWM_CHANNELS				2
+
+/**
+*@brief the resolution of the duty cycle in bits (1..8) , the duty cycle is
+*	from 0 to (2^SWPWM_BITS - 1).
+*/
+#define			SWPWM_BITS				8
+
+/**
+*@brief the length of the shortest slot (bit 0) in Timer2 ticks , it must be a
+*	power of two and long enough to cover the interrupt latency.
+*/
+#define			SWPWM_LSB_TICKS				4
+
+
+/******************************************************************************/
+/*			   Timer2 prescaler options		              */
+/******************************************************************************/
+
+#define			SWPWM_PRESCALER_1			1
+#define			SWPWM_PRESCALER_8			2
+#define			SWPWM_PRESCALER_32			3
+#define			SWPWM_PRESCALER_64			4
+#define			SWPWM_PRESCALER_128			5
+#define			SWPWM_PRESCALER_256			6
+#define			SWPWM_PRESCALER_1024			7
+
+/**
+*@brief the prescaler of Timer2 , the PWM frequency is :
+*	F_CPU / (prescaler * SWPWM_LSB_TICKS * (2^SWPWM_BITS - 1))
+*	EX:- 8MHz , SWPWM_PRESCALER_32 , 4 ticks and 8 bits gives 245 Hz.
+*/
+#define			SWPWM_PRESCALER				SWPWM_PRESCALER_32
+
+
+/*******************************************************************************/
+/*                          The SWPWM channels                                 */
+/*******************************************************************************/
+/**
+*@brief refer to channel 1
+*/
+#define			SWPWM_CH1					0
+
+/**
+*@brief refer to channel 2
+*/
+#define			SWPWM_CH2					1
+
+/**
+*@brief the port and the pin of each channel (PORT_NUM_PORTx and PORT_NUM_PINy) ,
+*	the sample channels are on PA5 and PA6 which the other shipped tables
+*	don't use. keep the channels which share a port together , they are
+*	written by one masked write.
+*/
+#define			SWPWM_CH1_PORT					PORT_NUM_PORTA
+#define			SWPWM_CH1_PIN					PORT_NUM_PIN6
+
+#define			SWPWM_CH2_PORT					PORT_NUM_PORTA
+#define			SWPWM_CH2_PIN					PORT_NUM_PIN7
+
+/**
+*@brief the pins of all channels in the port _P , add each channel which you configure.
+*/
+#define			SWPWM_PINS(_P)					(PORT_PIN_BIT(SWPWM_CH1_PORT,SWPWM_CH1_PIN,_P) | \
+								 PORT_PIN_BIT(SWPWM_CH2_PORT,SWPWM_CH2_PIN,_P))
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/**
+*@brief used to configure each channel what is it port and pin number.
+*/
+typedef struct
+{
+	PORT_enmPortOPTS_t  enmPort;	/*use to determine which port you
+					 want to use Like PORT_enmPortA*/
+	PORT_enumPins_t	    enmPin;	/*use to determine which pin you
+					want to use like PORT_enmPin1*/
+} SWPWM_stChannelCFG_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* SWPWM_CFG_H_ */
+/******************************************************************************/
@@ -16,6 +16,7 @@
 #include "../01_MCAL/01_PORT/PORT.h"
 
 #include "../01_MCAL/08_TWI/TWI.h" 
+#include "../01_MCAL/02_Interrupt/Critical.h"
 #include <avr/io.h>
 
 #include <math.h>
@@ -51,6 +52,7 @@ uint8_t arr[2] ={'g',0};
 	LED_enmInit();
 
 	address = Uart_pvInit(&stConfigrations);
+	CRITICAL_vEnableGlobal();
 	TWI_Mem_Write(&handle,0x50,0x000,'A',-1);
 	for(uint32_t i = 0 ;i < 10000 ; i++);
 	TWI_Mem_Write(&handle,0x50,0x001,'B',-1);
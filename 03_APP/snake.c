@@ -4,8 +4,10 @@
 #if CFG_IS_CURRENT_APP(CFG_APP_MAIN)
 #include "../00_LIB/Platform_Types.h"
 #include "../01_MCAL/02_Interrupt/Interrupt.h"
+#include "../01_MCAL/02_Interrupt/Critical.h"
 #include "../02_HAL/01_Switch/SWITCH.h"
 #include "../02_HAL/03_LCD/LCD.h"
+#include "../04_SERVICES/06_EventBus/EVB.h"
 #define  F_CPU      8000000
 #include <util/delay.h>
 uint8_t screen_segments[32][8] = { 0 };
@@ -30,12 +32,22 @@ uint8_t pos ;
 
 
 void left_button(void* y)
+{
+	EVB_enuPost(EVB_EVT_TURN_LEFT,0);
+}
+
+void right_button(void * x)
+{
+	EVB_enuPost(EVB_EVT_TURN_RIGHT,0);
+}
+
+void APP_vTurnLeft(uint8_t Copy_u8Event, uint16_t Copy_u16Data)
 {
 	direction++;
 	direction %=4;
 }
 
-void right_button(void * x)
+void APP_vTurnRight(uint8_t Copy_u8Event, uint16_t Copy_u16Data)
 {
 	direction--;
 	direction %=4;
@@ -240,14 +252,17 @@ int main ()
     LCD_init();
     LED_enmInit();
     pos =rand()%32;
+    EVB_vInit();
     EXINT_init();
     SWITCH_enmInit();
     EXINT_enuSetCallBack(EXINT_enuEXINT0,left_button,NULL);
     EXINT_enuSetCallBack(EXINT_enuEXINT1,right_button,NULL);
+    CRITICAL_vEnableGlobal();
     int cnt = 2;
     while (!game_end)
     {
 	
+	    EVB_vDispatch();
 	    display(); 
 	    move();
 	   _delay_ms(300);
@@ -0,0 +1,473 @@
+/******************************************************************************/
+/**
+ * @file SWTMR.c
+ * @brief software timers service on a hierarchical timing wheel.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * each running timer is linked in one slot of the wheel by its expiry time.
+ * level 0 has a slot for each tick , level 1 a slot for each 16 ticks , level
+ * 2 for each 256 ticks and level 3 for each 4096 ticks. when the low bits of
+ * the time become zero the current slot of the higher level is moved down to
+ * the lower levels , and the current slot of level 0 expires all its timers.
+ * the timers are linked by their indexes in a static pool , the expired timers
+ * wait in a FIFO until SWTMR_vProcess calls their callbacks.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "SWTMR.h"
+#include "SWTMR_CFG.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the shape of the wheel.
+*/
+#define			LEVELS					4
+#define			SLOT_BITS				4
+#define			SLOTS					(1 << SLOT_BITS)
+#define			SLOT_MASK				(SLOTS - 1)
+
+/**
+*@brief the end of a list.
+*/
+#define			NONE					0xFF
+
+/**
+*@brief the state bits of each timer.
+*/
+#define			STATE_RUNNING				0x01
+#define			STATE_PERIODIC				0x02
+#define			STATE_QUEUED				0x04
+#define			STATE_IN_FIFO				0x08
+
+/******************************************************************************/
+
+#if SWTMR_MAX_TIMERS < 1 || SWTMR_MAX_TIMERS >= NONE
+#error SWTMR_MAX_TIMERS must be from 1 to 254.
+#endif
+
+#if SWTMR_TICK_MS < 1
+#error SWTMR_TICK_MS must be 1 at least.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/**
+*@brief the list of the slot in the level.
+*/
+#define			LIST(_LEVEL,_SLOT)			(((_LEVEL) * SLOTS) + (_SLOT))
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/**
+*@brief one software timer.
+*/
+typedef struct
+{
+	void (*ADD_pfCallBack)(void*);
+	void * vpFuncParam;
+	uint32_t u32Expiry;
+	uint32_t u32Period;
+	uint8_t u8Next;
+	uint8_t u8Prev;
+	uint8_t u8List;
+	uint8_t u8FifoNext;
+	uint8_t u8State;
+} stTimer_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the pool of the timers.
+*/
+static stTimer_t astTimers[SWTMR_MAX_TIMERS];
+
+/**
+*@brief the first timer of each slot.
+*/
+static uint8_t au8Heads[LEVELS * SLOTS];
+
+/**
+*@brief the number of ticks since the init.
+*/
+static uint32_t u32Now = 0;
+
+/**
+*@brief the FIFO of the expired timers.
+*/
+static uint8_t u8FifoHead = NONE;
+static uint8_t u8FifoTail = NONE;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief links the timer in the slot of its expiry.
+*/
+static void vLink(uint8_t Copy_u8Timer);
+
+/**
+* @brief removes the timer from its slot.
+*/
+static void vUnlink(uint8_t Copy_u8Timer);
+
+/**
+* @brief moves all the timers of a slot to the lower levels.
+*/
+static void vCascade(uint8_t Copy_u8List);
+
+/**
+* @brief expires all the timers of the current level 0 slot.
+*/
+static void vExpire(uint8_t Copy_u8List);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static void vLink(uint8_t Copy_u8Timer)
+{
+	stTimer_t * LOC_pstTimer = &astTimers[Copy_u8Timer];
+	uint32_t LOC_u32Delta = LOC_pstTimer->u32Expiry - u32Now;
+	uint8_t LOC_u8List;
+
+	if(LOC_u32Delta < ((uint32_t)1 << SLOT_BITS))
+	{
+		LOC_u8List = LIST(0,LOC_pstTimer->u32Expiry & SLOT_MASK);
+	}
+	else if(LOC_u32Delta < ((uint32_t)1 << (2 * SLOT_BITS)))
+	{
+		LOC_u8List = LIST(1,(LOC_pstTimer->u32Expiry >> SLOT_BITS) & SLOT_MASK);
+	}
+	else if(LOC_u32Delta < ((uint32_t)1 << (3 * SLOT_BITS)))
+	{
+		LOC_u8List = LIST(2,(LOC_pstTimer->u32Expiry >> (2 * SLOT_BITS)) & SLOT_MASK);
+	}
+	else if(LOC_u32Delta < ((uint32_t)1 << (4 * SLOT_BITS)))
+	{
+		LOC_u8List = LIST(3,(LOC_pstTimer->u32Expiry >> (3 * SLOT_BITS)) & SLOT_MASK);
+	}
+	else
+	{
+		/*longer than the wheel , it waits in the last level 3 slot and is linked again from there*/
+		LOC_u8List = LIST(3,(u32Now >> (3 * SLOT_BITS)) & SLOT_MASK);
+	}
+
+	LOC_pstTimer->u8List = LOC_u8List;
+	LOC_pstTimer->u8Prev = NONE;
+	LOC_pstTimer->u8Next = au8Heads[LOC_u8List];
+	if(au8Heads[LOC_u8List] != NONE)
+	{
+		astTimers[au8Heads[LOC_u8List]].u8Prev = Copy_u8Timer;
+	}
+	au8Heads[LOC_u8List] = Copy_u8Timer;
+}
+
+static void vUnlink(uint8_t Copy_u8Timer)
+{
+	stTimer_t * LOC_pstTimer = &astTimers[Copy_u8Timer];
+	if(LOC_pstTimer->u8Prev == NONE)
+	{
+		au8Heads[LOC_pstTimer->u8List] = LOC_pstTimer->u8Next;
+	}
+	else
+	{
+		astTimers[LOC_pstTimer->u8Prev].u8Next = LOC_pstTimer->u8Next;
+	}
+	if(LOC_pstTimer->u8Next != NONE)
+	{
+		astTimers[LOC_pstTimer->u8Next].u8Prev = LOC_pstTimer->u8Prev;
+	}
+	LOC_pstTimer->u8List = NONE;
+}
+
+static void vCascade(uint8_t Copy_u8List)
+{
+	/*take the whole slot , the timers are linked again in the lower levels*/
+	uint8_t LOC_u8Timer = au8Heads[Copy_u8List];
+	au8Heads[Copy_u8List] = NONE;
+	while(LOC_u8Timer != NONE)
+	{
+		uint8_t LOC_u8Next = astTimers[LOC_u8Timer].u8Next;
+		vLink(LOC_u8Timer);
+		LOC_u8Timer = LOC_u8Next;
+	}
+}
+
+static void vExpire(uint8_t Copy_u8List)
+{
+	uint8_t LOC_u8Timer = au8Heads[Copy_u8List];
+	au8Heads[Copy_u8List] = NONE;
+	while(LOC_u8Timer != NONE)
+	{
+		stTimer_t * LOC_pstTimer = &astTimers[LOC_u8Timer];
+		uint8_t LOC_u8Next = LOC_pstTimer->u8Next;
+
+		if(LOC_pstTimer->u8State & STATE_PERIODIC)
+		{
+			/*the next expiry is counted from this one , not from the processing*/
+			LOC_pstTimer->u32Expiry += LOC_pstTimer->u32Period;
+			vLink(LOC_u8Timer);
+		}
+		else
+		{
+			LOC_pstTimer->u8List   = NONE;
+			LOC_pstTimer->u8State &= (uint8_t)~STATE_RUNNING;
+		}
+
+		/*the timer is in the FIFO once even if it expires again before processing*/
+		LOC_pstTimer->u8State |= STATE_QUEUED;
+		if((LOC_pstTimer->u8State & STATE_IN_FIFO) == 0)
+		{
+			LOC_pstTimer->u8State   |= STATE_IN_FIFO;
+			LOC_pstTimer->u8FifoNext = NONE;
+			if(u8FifoTail == NONE)
+			{
+				u8FifoHead = LOC_u8Timer;
+			}
+			else
+			{
+				astTimers[u8FifoTail].u8FifoNext = LOC_u8Timer;
+			}
+			u8FifoTail = LOC_u8Timer;
+		}
+		LOC_u8Timer = LOC_u8Next;
+	}
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+void SWTMR_vInit(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	for(uint8_t LOC_u8List = 0 ; LOC_u8List < (LEVELS * SLOTS) ; LOC_u8List++)
+	{
+		au8Heads[LOC_u8List] = NONE;
+	}
+	for(uint8_t LOC_u8Timer = 0 ; LOC_u8Timer < SWTMR_MAX_TIMERS ; LOC_u8Timer++)
+	{
+		astTimers[LOC_u8Timer].u8List  = NONE;
+		astTimers[LOC_u8Timer].u8State = 0;
+	}
+	u8FifoHead = NONE;
+	u8FifoTail = NONE;
+	u32Now     = 0;
+	CRITICAL_vExit(LOC_u8SREG);
+}
+
+
+SWTMR_enuErrors_t SWTMR_enuStart(uint8_t Copy_u8Timer, uint32_t Copy_u32Ticks, SWTMR_enuMode_t Copy_enuMode,
+				 void (*ADD_pfCallBack)(void*), void * ADD_pvParam)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	SWTMR_enuErrors_t RET_enuErrorStatus = SWTMR_enuOK;
+
+	if(Copy_u8Timer >= SWTMR_MAX_TIMERS)
+	{
+		RET_enuErrorStatus = SWTMR_enuInvalidTimer;
+	}
+	else if(Copy_u32Ticks == 0)
+	{
+		RET_enuErrorStatus = SWTMR_enuInvalidTicks;
+	}
+	else if(Copy_enuMode != SWTMR_enuOneShot && Copy_enuMode != SWTMR_enuPeriodic)
+	{
+		RET_enuErrorStatus = SWTMR_enuInvalidMode;
+	}
+	else if(ADD_pfCallBack == NULL)
+	{
+		RET_enuErrorStatus = SWTMR_enuNullPtr;
+	}
+	else
+	{
+		stTimer_t * LOC_pstTimer = &astTimers[Copy_u8Timer];
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the tick moves the timers*/
+		if(LOC_pstTimer->u8State & STATE_RUNNING)
+		{
+			vUnlink(Copy_u8Timer);
+		}
+		LOC_pstTimer->ADD_pfCallBack = ADD_pfCallBack;
+		LOC_pstTimer->vpFuncParam    = ADD_pvParam;
+		LOC_pstTimer->u32Period      = Copy_u32Ticks;
+		LOC_pstTimer->u32Expiry      = u32Now + Copy_u32Ticks;
+		LOC_pstTimer->u8State        = (LOC_pstTimer->u8State & STATE_IN_FIFO) | STATE_RUNNING |
+					       ((Copy_enuMode == SWTMR_enuPeriodic) ? STATE_PERIODIC : 0);
+		vLink(Copy_u8Timer);
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+SWTMR_enuErrors_t SWTMR_enuStop(uint8_t Copy_u8Timer)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	SWTMR_enuErrors_t RET_enuErrorStatus = SWTMR_enuOK;
+
+	if(Copy_u8Timer >= SWTMR_MAX_TIMERS)
+	{
+		RET_enuErrorStatus = SWTMR_enuInvalidTimer;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the tick moves the timers*/
+		if(astTimers[Copy_u8Timer].u8State & STATE_RUNNING)
+		{
+			vUnlink(Copy_u8Timer);
+		}
+		/*if it is in the FIFO , SWTMR_vProcess skips it*/
+		astTimers[Copy_u8Timer].u8State &= STATE_IN_FIFO;
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+boolean SWTMR_bIsRunning(uint8_t Copy_u8Timer)
+{
+	boolean RET_bRunning = FALSE;
+	if(Copy_u8Timer < SWTMR_MAX_TIMERS && (astTimers[Copy_u8Timer].u8State & STATE_RUNNING))
+	{
+		RET_bRunning = TRUE;
+	}
+	return RET_bRunning;
+}
+
+
+uint32_t SWTMR_u32GetTicks(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the tick may change the time in the middle*/
+	uint32_t LOC_u32Now = u32Now;
+	CRITICAL_vExit(LOC_u8SREG);
+	return LOC_u32Now;
+}
+
+
+void SWTMR_vTick(void * ADD_pvParam)
+{
+	u32Now++;
+
+	/*find the highest level which starts a new slot now*/
+	uint8_t LOC_u8Level = 0;
+	while(LOC_u8Level < (LEVELS - 1) &&
+	      (u32Now & (((uint32_t)1 << ((LOC_u8Level + 1) * SLOT_BITS)) - 1)) == 0)
+	{
+		LOC_u8Level++;
+	}
+
+	/*move the slots down from the highest level , so a timer can go down more than one level*/
+	while(LOC_u8Level > 0)
+	{
+		vCascade(LIST(LOC_u8Level,(u32Now >> (LOC_u8Level * SLOT_BITS)) & SLOT_MASK));
+		LOC_u8Level--;
+	}
+
+	vExpire(LIST(0,u32Now & SLOT_MASK));
+}
+
+
+void SWTMR_vProcess(void)
+{
+	boolean LOC_bEmpty = FALSE;
+	while(!LOC_bEmpty)
+	{
+		void (*LOC_pfCallBack)(void*) = NULL;
+		void * LOC_pvParam = NULL;
+
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the tick adds to the FIFO*/
+		uint8_t LOC_u8Timer = u8FifoHead;
+		if(LOC_u8Timer == NONE)
+		{
+			LOC_bEmpty = TRUE;
+		}
+		else
+		{
+			stTimer_t * LOC_pstTimer = &astTimers[LOC_u8Timer];
+			u8FifoHead = LOC_pstTimer->u8FifoNext;
+			if(u8FifoHead == NONE)
+			{
+				u8FifoTail = NONE;
+			}
+			if(LOC_pstTimer->u8State & STATE_QUEUED)
+			{
+				LOC_pfCallBack = LOC_pstTimer->ADD_pfCallBack;
+				LOC_pvParam    = LOC_pstTimer->vpFuncParam;
+			}
+			LOC_pstTimer->u8State &= (uint8_t)~(STATE_QUEUED | STATE_IN_FIFO);
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+
+		/*the callback runs with the interrupts as they were , it can start and stop timers*/
+		if(LOC_pfCallBack != NULL)
+		{
+			LOC_pfCallBack(LOC_pvParam);
+		}
+	}
+}
+
+/******************************************************************************/
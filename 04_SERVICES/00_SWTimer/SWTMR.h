@@ -0,0 +1,231 @@
+/******************************************************************************/
+/**
+ * @file SWTMR.h
+ * @brief software timers service API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * software timers service. all the timers run on one hardware tick and are
+ * kept in a hierarchical timing wheel (4 levels of 16 slots) , so starting ,
+ * stopping and expiring a timer don't depend on the number of timers.
+ * the tick only moves the timers , the callbacks are called from the main
+ * loop by SWTMR_vProcess.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef SWTMR_H_
+#define SWTMR_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "SWTMR_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief converts milli-seconds to ticks , the time is rounded up to one tick at least.
+*	EX:- SWTMR_enuStart(0,SWTMR_MS_TO_TICKS(250),SWTMR_enuPeriodic,vBlink,NULL);
+*/
+#define SWTMR_MS_TO_TICKS(_MS)		((((_MS) + SWTMR_TICK_MS - 1) / SWTMR_TICK_MS) == 0 ? 1 : \
+					 (((_MS) + SWTMR_TICK_MS - 1) / SWTMR_TICK_MS))
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all software timers errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     SWTMR_enuOK ,
+
+     /**
+     *@brief if you entered a timer out of SWTMR_MAX_TIMERS.
+     */
+     SWTMR_enuInvalidTimer,
+
+     /**
+     *@brief if you entered zero ticks.
+     */
+     SWTMR_enuInvalidTicks,
+
+     /**
+     *@brief if you entered a mode which is not one shot or periodic.
+     */
+     SWTMR_enuInvalidMode,
+
+    /**
+    *@brief returned if you pass a null pointer to functions.
+    */
+     SWTMR_enuNullPtr
+
+} SWTMR_enuErrors_t;
+
+
+/*
+*@brief the modes of the software timer.
+*
+*/
+typedef enum
+{
+     /**
+     *@brief the callback is called once then the timer stops.
+     */
+     SWTMR_enuOneShot,
+
+     /**
+     *@brief the callback is called every period , the period is counted from
+     *	the last expiry so the timer doesn't drift.
+     */
+     SWTMR_enuPeriodic
+
+} SWTMR_enuMode_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief stops all the timers and clears the time.
+ */
+void SWTMR_vInit(void);
+
+/**
+ * @brief starts or restarts a timer.
+ *
+ * @param[in] Copy_u8Timer	the timer from 0 to (SWTMR_MAX_TIMERS - 1).
+ *
+ * @param[in] Copy_u32Ticks	the time to the first expiry and the period in ticks.
+ *
+ * @param[in] Copy_enuMode	SWTMR_enuOneShot or SWTMR_enuPeriodic.
+ *
+ * @param[in] ADD_pfCallBack	the function which is called at the expiry.
+ *
+ * @param[in] ADD_pvParam	generic pointer passed to the callback.
+ *
+ * @return the software timers error status.
+ *
+ * @note a callback of the old start which is not called yet is cancelled.
+ */
+SWTMR_enuErrors_t SWTMR_enuStart(uint8_t Copy_u8Timer, uint32_t Copy_u32Ticks, SWTMR_enuMode_t Copy_enuMode,
+				 void (*ADD_pfCallBack)(void*), void * ADD_pvParam);
+
+/**
+ * @brief stops a timer , its callback is not called even if it is expired
+ *	and not processed yet.
+ *
+ * @param[in] Copy_u8Timer	the timer from 0 to (SWTMR_MAX_TIMERS - 1).
+ *
+ * @return the software timers error status.
+ */
+SWTMR_enuErrors_t SWTMR_enuStop(uint8_t Copy_u8Timer);
+
+/**
+ * @brief checks if the timer is running.
+ *
+ * @param[in] Copy_u8Timer	the timer from 0 to (SWTMR_MAX_TIMERS - 1).
+ *
+ * @return TRUE if the timer is waiting its expiry.
+ */
+boolean SWTMR_bIsRunning(uint8_t Copy_u8Timer);
+
+/**
+ * @brief gets the number of ticks since SWTMR_vInit.
+ */
+uint32_t SWTMR_u32GetTicks(void);
+
+/**
+ * @brief moves the time one tick and collects the expired timers , it is
+ *	called from the periodic hardware interrupt.
+ *
+ * @param[in] ADD_pvParam	not used , it makes the function a timer callback.
+ *	EX:- Timer_enuSetCallBack(Timer_enuTimer0,SWTMR_vTick,NULL);
+ */
+void SWTMR_vTick(void * ADD_pvParam);
+
+/**
+ * @brief calls the callbacks of the expired timers , call it from the main loop.
+ */
+void SWTMR_vProcess(void);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* SWTMR_H_ */
+/******************************************************************************/
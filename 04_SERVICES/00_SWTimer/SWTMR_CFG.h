@@ -0,0 +1,111 @@
+/*******************************************************************************/
+/**
+* @file SWTMR_CFG.h
+* @brief Header file for software timers configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the software timers service
+* which runs any number of one shot and periodic timers on one hardware tick.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef SWTMR_CFG_H_
+#define SWTMR_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   SWTMR Configurations		                      */
+/******************************************************************************/
+
+/**
+*@brief the number of the software timers , the timers are numbered from 0 to
+*	(SWTMR_MAX_TIMERS - 1) , it must be from 1 to 254.
+*/
+#define			SWTMR_MAX_TIMERS			32
+
+/**
+*@brief the period of the hardware tick which calls SWTMR_vTick in milli-seconds.
+*/
+#define			SWTMR_TICK_MS				10
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* SWTMR_CFG_H_ */
+/******************************************************************************/
@@ -0,0 +1,532 @@
+/******************************************************************************/
+/**
+ * @file TLTMR.c
+ * @brief tickless timers service on the Timer1 compare match.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * Timer1 runs free in normal mode and is never cleared , the time is the
+ * count of its overflows in the high 16 bits and TCNT1 in the low 16 bits.
+ * the running timers are linked by their indexes in a list sorted by their
+ * deadlines , the compare match A interrupt is enabled only when the nearest
+ * deadline is less than one counter wrap away , then OCR1A is its low 16 bits.
+ * otherwise each overflow checks again. the compare match interrupt expires
+ * all the due timers , links the periodic ones again by their next deadline
+ * and programs OCR1A to the new nearest deadline.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "TLTMR.h"
+#include "TLTMR_CFG.h"
+#include "../../00_LIB/BIT_MATH.h"
+#include "../../01_MCAL/02_Interrupt/ISR.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+#include "../../01_MCAL/02_Interrupt/Interrupt_CFG.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief Timer1 registers.
+*/
+#define			TCCR1A					*((volatile uint8_t *)0x4F)
+#define			TCCR1B					*((volatile uint8_t *)0x4E)
+#define			TCNT1					*((volatile uint16_t *)0x4C)
+#define			OCR1A					*((volatile uint16_t *)0x4A)
+#define			TIMSK					*((volatile uint8_t *)0x59)
+#define			TIFR					*((volatile uint8_t *)0x58)
+
+#define			TOIE1					2
+#define			OCIE1A					4
+#define			TOV1					2
+#define			OCF1A					4
+
+/**
+*@brief the end of the list.
+*/
+#define			NONE					0xFF
+
+/**
+*@brief the longest time to the deadline which the compare match can wait ,
+*	a farther deadline waits the next overflows.
+*/
+#define			MAX_COMPARE_TICKS			0xFFFFUL
+
+/******************************************************************************/
+
+#if TLTMR_MAX_TIMERS < 1 || TLTMR_MAX_TIMERS >= NONE
+#error TLTMR_MAX_TIMERS must be from 1 to 254.
+#endif
+
+#if TLTMR_MIN_TICKS < 1
+#error TLTMR_MIN_TICKS must be 1 at least.
+#endif
+
+#if TLTMR_PRESCALER < TLTMR_CLK_1 || TLTMR_PRESCALER > TLTMR_CLK_1024
+#error TLTMR_PRESCALER configure in wrong way.
+#endif
+
+#if TIMER1_ENABLE == ON
+#error Timer1 is owned by the tickless timers , TIMER1_ENABLE must be OFF.
+#endif
+
+#if ISR_TRACE == ISR_ON && ISR_TRACE_PRESCALER != TLTMR_PRESCALER
+#error the trace and the tickless timers share Timer1 , they must use the same prescaler.
+#endif
+
+#if ((INT0 == ENABLE && INT0_CAPTURE == ENABLE) || (INT1 == ENABLE && INT1_CAPTURE == ENABLE) || \
+     (INT2 == ENABLE && INT2_CAPTURE == ENABLE)) && EXINT_CAPTURE_PRESCALER != TLTMR_PRESCALER
+#error the edge capture and the tickless timers share Timer1 , they must use the same prescaler.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/**
+*@brief TRUE if the time _A is before the time _B , it is right while the
+*	distance between them is less than 2^31 ticks.
+*/
+#define			IS_BEFORE(_A,_B)			((sint32_t)((_A) - (_B)) < 0)
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/**
+*@brief one tickless timer.
+*/
+typedef struct
+{
+	void (*ADD_pfCallBack)(void*);
+	void * vpFuncParam;
+	uint32_t u32Deadline;
+	uint32_t u32Period;
+	uint8_t u8Next;
+	boolean bRunning;
+	boolean bPeriodic;
+} stTimer_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the pool of the timers.
+*/
+static stTimer_t astTimers[TLTMR_MAX_TIMERS];
+
+/**
+*@brief the timer of the nearest deadline.
+*/
+static uint8_t u8Head = NONE;
+
+/**
+*@brief the number of the Timer1 overflows , the high 16 bits of the time.
+*/
+static volatile uint16_t u16Overflows = 0;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief gets the 32-bit time , called with the interrupts disabled.
+*/
+static uint32_t u32ReadTime(void);
+
+/**
+* @brief links the timer in the list by its deadline , after the timers of
+*	the same deadline.
+*/
+static void vLink(uint8_t Copy_u8Timer);
+
+/**
+* @brief removes the timer from the list.
+*/
+static void vUnlink(uint8_t Copy_u8Timer);
+
+/**
+* @brief programs the compare match to the nearest deadline or disables it.
+*/
+static void vProgram(void);
+
+static void vOvfHandler(void * ADD_pvParam);
+static void vCompHandler(void * ADD_pvParam);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
+/**
+* @brief Timer1 overflow interrupt service routine.
+*/
+void __vector_9(void) __attribute__((signal));
+#endif
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
+/**
+* @brief Timer1 compare match A interrupt service routine.
+*/
+void __vector_7(void) __attribute__((signal));
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static uint32_t u32ReadTime(void)
+{
+	uint16_t LOC_u16Overflows = u16Overflows;
+	uint16_t LOC_u16Count     = TCNT1;
+
+	/*the counter wrapped and its interrupt is not served yet*/
+	if((TIFR & (1 << TOV1)) && LOC_u16Count < 0x8000)
+	{
+		LOC_u16Overflows++;
+	}
+	return ((uint32_t)LOC_u16Overflows << 16) | LOC_u16Count;
+}
+
+static void vLink(uint8_t Copy_u8Timer)
+{
+	stTimer_t * LOC_pstTimer = &astTimers[Copy_u8Timer];
+
+	if(u8Head == NONE || IS_BEFORE(LOC_pstTimer->u32Deadline,astTimers[u8Head].u32Deadline))
+	{
+		LOC_pstTimer->u8Next = u8Head;
+		u8Head = Copy_u8Timer;
+	}
+	else
+	{
+		uint8_t LOC_u8Prev = u8Head;
+		while(astTimers[LOC_u8Prev].u8Next != NONE &&
+		      !IS_BEFORE(LOC_pstTimer->u32Deadline,astTimers[astTimers[LOC_u8Prev].u8Next].u32Deadline))
+		{
+			LOC_u8Prev = astTimers[LOC_u8Prev].u8Next;
+		}
+		LOC_pstTimer->u8Next = astTimers[LOC_u8Prev].u8Next;
+		astTimers[LOC_u8Prev].u8Next = Copy_u8Timer;
+	}
+}
+
+static void vUnlink(uint8_t Copy_u8Timer)
+{
+	if(u8Head == Copy_u8Timer)
+	{
+		u8Head = astTimers[Copy_u8Timer].u8Next;
+	}
+	else
+	{
+		uint8_t LOC_u8Prev = u8Head;
+		while(LOC_u8Prev != NONE && astTimers[LOC_u8Prev].u8Next != Copy_u8Timer)
+		{
+			LOC_u8Prev = astTimers[LOC_u8Prev].u8Next;
+		}
+		if(LOC_u8Prev != NONE)
+		{
+			astTimers[LOC_u8Prev].u8Next = astTimers[Copy_u8Timer].u8Next;
+		}
+	}
+	astTimers[Copy_u8Timer].u8Next = NONE;
+}
+
+static void vProgram(void)
+{
+	if(u8Head == NONE)
+	{
+		CLR_BIT(TIMSK,OCIE1A);
+	}
+	else
+	{
+		uint32_t LOC_u32Now    = u32ReadTime();
+		uint32_t LOC_u32Target = astTimers[u8Head].u32Deadline;
+
+		if(IS_BEFORE(LOC_u32Target,LOC_u32Now + TLTMR_MIN_TICKS))
+		{
+			/*too near to be caught by the compare match , it fires a little late*/
+			LOC_u32Target = LOC_u32Now + TLTMR_MIN_TICKS;
+		}
+
+		if((LOC_u32Target - LOC_u32Now) > MAX_COMPARE_TICKS)
+		{
+			/*the counter passes the low bits of the deadline before it , the overflows check again*/
+			CLR_BIT(TIMSK,OCIE1A);
+		}
+		else
+		{
+			uint32_t LOC_u32Lead = TLTMR_MIN_TICKS;
+			OCR1A = (uint16_t)LOC_u32Target;
+			TIFR  = (1 << OCF1A);							/*clear the old flag by writing one*/
+
+			/*with a fast clock the counter may pass the target while it is written ,
+			  the compare match would wait a whole wrap so it is set again farther*/
+			LOC_u32Now = u32ReadTime();
+			while(!IS_BEFORE(LOC_u32Now,LOC_u32Target) && (TIFR & (1 << OCF1A)) == 0)
+			{
+				LOC_u32Lead <<= 1;
+				LOC_u32Target = LOC_u32Now + LOC_u32Lead;
+				OCR1A = (uint16_t)LOC_u32Target;
+				TIFR  = (1 << OCF1A);
+				LOC_u32Now = u32ReadTime();
+			}
+			SET_BIT(TIMSK,OCIE1A);
+		}
+	}
+}
+
+static void vOvfHandler(void * ADD_pvParam)
+{
+	u16Overflows++;
+	if(u8Head != NONE && (TIMSK & (1 << OCIE1A)) == 0)
+	{
+		vProgram();
+	}
+}
+
+static void vCompHandler(void * ADD_pvParam)
+{
+	uint32_t LOC_u32Now = u32ReadTime();
+
+	while(u8Head != NONE && !IS_BEFORE(LOC_u32Now,astTimers[u8Head].u32Deadline))
+	{
+		uint8_t LOC_u8Timer = u8Head;
+		stTimer_t * LOC_pstTimer = &astTimers[LOC_u8Timer];
+
+		u8Head = LOC_pstTimer->u8Next;
+		if(LOC_pstTimer->bPeriodic == TRUE)
+		{
+			/*the next deadline is counted from this one , not from now*/
+			LOC_pstTimer->u32Deadline += LOC_pstTimer->u32Period;
+			vLink(LOC_u8Timer);
+		}
+		else
+		{
+			LOC_pstTimer->u8Next   = NONE;
+			LOC_pstTimer->bRunning = FALSE;
+		}
+
+		/*the callback may start and stop timers , the list is read again after it*/
+		ISR_vCallBack(LOC_pstTimer->ADD_pfCallBack,LOC_pstTimer->vpFuncParam);
+		LOC_u32Now = u32ReadTime();
+	}
+
+	vProgram();
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+void TLTMR_vInit(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	for(uint8_t LOC_u8Timer = 0 ; LOC_u8Timer < TLTMR_MAX_TIMERS ; LOC_u8Timer++)
+	{
+		astTimers[LOC_u8Timer].u8Next   = NONE;
+		astTimers[LOC_u8Timer].bRunning = FALSE;
+	}
+	u8Head       = NONE;
+	u16Overflows = 0;
+
+	#if ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
+	ISR_enuAttach(ISR_VECT_TIMER1_OVF,vOvfHandler,NULL);
+	#endif
+	#if ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
+	ISR_enuAttach(ISR_VECT_TIMER1_COMPA,vCompHandler,NULL);
+	#endif
+
+	/*Timer1 in normal mode , it is never cleared so the trace and the capture can share it*/
+	TCCR1A = 0;
+	TCCR1B = TLTMR_PRESCALER;
+	CLR_BIT(TIMSK,OCIE1A);
+	TIFR   = (1 << TOV1);								/*clear the old flag by writing one*/
+	SET_BIT(TIMSK,TOIE1);
+	CRITICAL_vExit(LOC_u8SREG);
+}
+
+
+TLTMR_enuErrors_t TLTMR_enuStart(uint8_t Copy_u8Timer, uint32_t Copy_u32Ticks, TLTMR_enuMode_t Copy_enuMode,
+				 void (*ADD_pfCallBack)(void*), void * ADD_pvParam)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	TLTMR_enuErrors_t RET_enuErrorStatus = TLTMR_enuOK;
+
+	if(Copy_u8Timer >= TLTMR_MAX_TIMERS)
+	{
+		RET_enuErrorStatus = TLTMR_enuInvalidTimer;
+	}
+	else if(Copy_u32Ticks == 0 || Copy_u32Ticks > 0x7FFFFFFFUL)
+	{
+		RET_enuErrorStatus = TLTMR_enuInvalidTicks;
+	}
+	else if(Copy_enuMode != TLTMR_enuOneShot && Copy_enuMode != TLTMR_enuPeriodic)
+	{
+		RET_enuErrorStatus = TLTMR_enuInvalidMode;
+	}
+	else if(ADD_pfCallBack == NULL)
+	{
+		RET_enuErrorStatus = TLTMR_enuNullPtr;
+	}
+	else
+	{
+		stTimer_t * LOC_pstTimer = &astTimers[Copy_u8Timer];
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the compare match moves the timers*/
+		if(LOC_pstTimer->bRunning == TRUE)
+		{
+			vUnlink(Copy_u8Timer);
+		}
+		LOC_pstTimer->ADD_pfCallBack = ADD_pfCallBack;
+		LOC_pstTimer->vpFuncParam    = ADD_pvParam;
+		LOC_pstTimer->u32Period      = Copy_u32Ticks;
+		LOC_pstTimer->u32Deadline    = u32ReadTime() + Copy_u32Ticks;
+		LOC_pstTimer->bPeriodic      = (Copy_enuMode == TLTMR_enuPeriodic) ? TRUE : FALSE;
+		LOC_pstTimer->bRunning       = TRUE;
+		vLink(Copy_u8Timer);
+		if(u8Head == Copy_u8Timer)
+		{
+			vProgram();
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+TLTMR_enuErrors_t TLTMR_enuStop(uint8_t Copy_u8Timer)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	TLTMR_enuErrors_t RET_enuErrorStatus = TLTMR_enuOK;
+
+	if(Copy_u8Timer >= TLTMR_MAX_TIMERS)
+	{
+		RET_enuErrorStatus = TLTMR_enuInvalidTimer;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the compare match moves the timers*/
+		if(astTimers[Copy_u8Timer].bRunning == TRUE)
+		{
+			boolean LOC_bWasHead = (u8Head == Copy_u8Timer) ? TRUE : FALSE;
+			vUnlink(Copy_u8Timer);
+			astTimers[Copy_u8Timer].bRunning = FALSE;
+			if(LOC_bWasHead == TRUE)
+			{
+				vProgram();
+			}
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+boolean TLTMR_bIsRunning(uint8_t Copy_u8Timer)
+{
+	boolean RET_bRunning = FALSE;
+	if(Copy_u8Timer < TLTMR_MAX_TIMERS && astTimers[Copy_u8Timer].bRunning == TRUE)
+	{
+		RET_bRunning = TRUE;
+	}
+	return RET_bRunning;
+}
+
+
+uint32_t TLTMR_u32GetTicks(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the overflow may change the time in the middle*/
+	uint32_t LOC_u32Now = u32ReadTime();
+	CRITICAL_vExit(LOC_u8SREG);
+	return LOC_u32Now;
+}
+
+
+uint32_t TLTMR_u32GetTicksToNext(void)
+{
+	uint32_t RET_u32Ticks = 0xFFFFFFFFUL;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	if(u8Head != NONE)
+	{
+		uint32_t LOC_u32Now = u32ReadTime();
+		if(IS_BEFORE(LOC_u32Now,astTimers[u8Head].u32Deadline))
+		{
+			RET_u32Ticks = astTimers[u8Head].u32Deadline - LOC_u32Now;
+		}
+		else
+		{
+			RET_u32Ticks = 0;
+		}
+	}
+	CRITICAL_vExit(LOC_u8SREG);
+	return RET_u32Ticks;
+}
+
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_OVF)
+void __vector_9(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_OVF);
+	vOvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_OVF);
+}
+#endif
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER1_COMPA)
+void __vector_7(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER1_COMPA);
+	vCompHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER1_COMPA);
+}
+#endif
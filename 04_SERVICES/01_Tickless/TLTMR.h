@@ -0,0 +1,244 @@
+/******************************************************************************/
+/**
+ * @file TLTMR.h
+ * @brief tickless timers service API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * tickless timers service. there is no periodic tick , the running timers are
+ * kept in a list sorted by their deadlines and the Timer1 compare match A is
+ * programmed to the nearest deadline only , so the CPU is woken once for each
+ * real expiry. the 16-bit counter is extended to 32-bit time by counting its
+ * overflows , the overflow interrupt is the only other wake.
+ * Timer1 is owned by this service , TIMER1_ENABLE must be OFF and the Timer1
+ * driver of 05_Timer1 must not be linked with it. the free running counter
+ * can be shared with the interrupts trace and the edge capture if they use
+ * the same prescaler.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef TLTMR_H_
+#define TLTMR_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "TLTMR_CFG.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the division of the CPU clock by the Timer1 prescaler.
+*/
+#define TLTMR_DIVISION			((TLTMR_PRESCALER == TLTMR_CLK_1)   ? 1UL   : \
+					 (TLTMR_PRESCALER == TLTMR_CLK_8)   ? 8UL   : \
+					 (TLTMR_PRESCALER == TLTMR_CLK_64)  ? 64UL  : \
+					 (TLTMR_PRESCALER == TLTMR_CLK_256) ? 256UL : 1024UL)
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief converts micro-seconds and milli-seconds to Timer1 ticks , the time is
+*	rounded up to one tick at least.
+*	EX:- TLTMR_enuStart(0,TLTMR_MS_TO_TICKS(1500),TLTMR_enuOneShot,vTimeout,NULL);
+*/
+#define TLTMR_US_TO_TICKS(_US)		((((uint32_t)(_US) * (F_CPU / 1000000UL)) + TLTMR_DIVISION - 1) / TLTMR_DIVISION)
+#define TLTMR_MS_TO_TICKS(_MS)		((((uint32_t)(_MS) * (F_CPU / 1000UL)) + TLTMR_DIVISION - 1) / TLTMR_DIVISION)
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all tickless timers errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     TLTMR_enuOK ,
+
+     /**
+     *@brief if you entered a timer out of TLTMR_MAX_TIMERS.
+     */
+     TLTMR_enuInvalidTimer,
+
+     /**
+     *@brief if you entered zero ticks or more than 0x7FFFFFFF ticks.
+     */
+     TLTMR_enuInvalidTicks,
+
+     /**
+     *@brief if you entered a mode which is not one shot or periodic.
+     */
+     TLTMR_enuInvalidMode,
+
+    /**
+    *@brief returned if you pass a null pointer to functions.
+    */
+     TLTMR_enuNullPtr
+
+} TLTMR_enuErrors_t;
+
+
+/*
+*@brief the modes of the tickless timer.
+*
+*/
+typedef enum
+{
+     /**
+     *@brief the callback is called once then the timer stops.
+     */
+     TLTMR_enuOneShot,
+
+     /**
+     *@brief the callback is called every period , the period is counted from
+     *	the last deadline so the timer doesn't drift.
+     */
+     TLTMR_enuPeriodic
+
+} TLTMR_enuMode_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief stops all the timers and starts Timer1 in normal mode with its
+ *	overflow interrupt.
+ *
+ * @note the global interrupt is not enabled here.
+ */
+void TLTMR_vInit(void);
+
+/**
+ * @brief starts or restarts a timer.
+ *
+ * @param[in] Copy_u8Timer	the timer from 0 to (TLTMR_MAX_TIMERS - 1).
+ *
+ * @param[in] Copy_u32Ticks	the time to the first deadline and the period in
+ *				Timer1 ticks , from 1 to 0x7FFFFFFF.
+ *
+ * @param[in] Copy_enuMode	TLTMR_enuOneShot or TLTMR_enuPeriodic.
+ *
+ * @param[in] ADD_pfCallBack	the function which is called at the deadline.
+ *
+ * @param[in] ADD_pvParam	generic pointer passed to the callback.
+ *
+ * @return the tickless timers error status.
+ *
+ * @note the callback is called inside the compare match interrupt (or posted
+ *	to the work queue if ISR_DEFER_CALLBACKS is ISR_ON) , it can start and
+ *	stop timers. a deadline nearer than TLTMR_MIN_TICKS is delayed to it.
+ */
+TLTMR_enuErrors_t TLTMR_enuStart(uint8_t Copy_u8Timer, uint32_t Copy_u32Ticks, TLTMR_enuMode_t Copy_enuMode,
+				 void (*ADD_pfCallBack)(void*), void * ADD_pvParam);
+
+/**
+ * @brief stops a timer.
+ *
+ * @param[in] Copy_u8Timer	the timer from 0 to (TLTMR_MAX_TIMERS - 1).
+ *
+ * @return the tickless timers error status.
+ */
+TLTMR_enuErrors_t TLTMR_enuStop(uint8_t Copy_u8Timer);
+
+/**
+ * @brief checks if the timer is running.
+ *
+ * @param[in] Copy_u8Timer	the timer from 0 to (TLTMR_MAX_TIMERS - 1).
+ *
+ * @return TRUE if the timer is waiting its deadline.
+ */
+boolean TLTMR_bIsRunning(uint8_t Copy_u8Timer);
+
+/**
+ * @brief gets the time in Timer1 ticks , it wraps after 2^32 ticks.
+ */
+uint32_t TLTMR_u32GetTicks(void);
+
+/**
+ * @brief gets the ticks to the nearest deadline , used to decide how deep the
+ *	CPU can sleep.
+ *
+ * @return the ticks to the nearest deadline , 0 if it is due now and
+ *	0xFFFFFFFF if no timer is running.
+ */
+uint32_t TLTMR_u32GetTicksToNext(void);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* TLTMR_H_ */
+/******************************************************************************/
@@ -0,0 +1,131 @@
+/*******************************************************************************/
+/**
+* @file TLTMR_CFG.h
+* @brief Header file for tickless timers configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the tickless timers service
+* which programs the Timer1 compare match to the next deadline only.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef TLTMR_CFG_H_
+#define TLTMR_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   TLTMR Configurations		                      */
+/******************************************************************************/
+
+/**
+*@brief the number of the tickless timers , the timers are numbered from 0 to
+*	(TLTMR_MAX_TIMERS - 1) , it must be from 1 to 254.
+*/
+#define			TLTMR_MAX_TIMERS			16
+
+/**
+*@brief the shortest time from now which the compare match can be set to , in
+*	Timer1 ticks. it must cover the time of programming OCR1A , a deadline
+*	nearer than it fires after TLTMR_MIN_TICKS. if the counter passes the
+*	target while it is written (TLTMR_CLK_1 or TLTMR_CLK_8) the lead is
+*	doubled until the compare match is caught , it fires a little late.
+*/
+#define			TLTMR_MIN_TICKS				3
+
+
+/******************************************************************************/
+/*			   Timer1 prescaler options		              */
+/******************************************************************************/
+
+#define			TLTMR_CLK_1				1
+#define			TLTMR_CLK_8				2
+#define			TLTMR_CLK_64				3
+#define			TLTMR_CLK_256				4
+#define			TLTMR_CLK_1024				5
+
+/**
+*@brief the clock of Timer1 , the overflow interrupt wakes the CPU every 65536
+*	ticks to extend the time (with 8MHz TLTMR_CLK_256 gives 32us for each tick
+*	and one overflow every 2.1 seconds).
+*/
+#define			TLTMR_PRESCALER				TLTMR_CLK_256
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* TLTMR_CFG_H_ */
+/******************************************************************************/
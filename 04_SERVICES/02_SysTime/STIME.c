@@ -0,0 +1,257 @@
+/******************************************************************************/
+/**
+ * @file STIME.c
+ * @brief system time service on the Timer0 overflow.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * Timer0 runs free in normal mode and is never cleared , the overflow
+ * interrupt counts the wraps of the 8-bit counter and adds the micro-seconds
+ * of one wrap to the milli-seconds and their remainder , so the milli-seconds
+ * are read without a division. a read takes the counts and TCNT0 with the
+ * interrupts disabled , a wrap which its interrupt is not served yet is added
+ * by checking the flag of the overflow.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "STIME.h"
+#include "STIME_CFG.h"
+#include "../../00_LIB/BIT_MATH.h"
+#include "../../01_MCAL/02_Interrupt/ISR.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief Timer0 registers.
+*/
+#define			TCCR0					*((volatile uint8_t *)0x53)
+#define			TCNT0					*((volatile uint8_t *)0x52)
+#define			TIMSK					*((volatile uint8_t *)0x59)
+#define			TIFR					*((volatile uint8_t *)0x58)
+
+#define			TOIE0					0
+#define			TOV0					0
+
+/**
+*@brief the micro-seconds of one wrap of the counter.
+*/
+#define			US_PER_OVERFLOW				(256UL * STIME_US_PER_TICK)
+
+/******************************************************************************/
+
+#if STIME_PRESCALER != STIME_CLK_8 && STIME_PRESCALER != STIME_CLK_64
+#error STIME_PRESCALER configure in wrong way.
+#endif
+
+#if (F_CPU % 1000000UL) != 0 || F_CPU < 1000000UL || (STIME_DIVISION % (F_CPU / 1000000UL)) != 0
+#error the Timer0 tick must be an integer number of micro-seconds , change STIME_PRESCALER.
+#endif
+
+#if TIMER0_ENABLE == ON
+#error Timer0 is owned by the system time , TIMER0_ENABLE must be OFF.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the number of the Timer0 overflows , the time above the 8 bits of TCNT0.
+*/
+static volatile uint32_t u32Overflows = 0;
+
+/**
+*@brief the milli-seconds of the served overflows and the remainder of them in
+*	micro-seconds , it is less than 1000.
+*/
+static volatile uint32_t u32Millis  = 0;
+static volatile uint16_t u16FractUs = 0;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief gets the overflows and the count of the counter , called with the
+*	interrupts disabled.
+*
+* @return TRUE if the counter wrapped and its interrupt is not served yet.
+*/
+static boolean bReadCounter(uint32_t * ADD_pu32Overflows, uint8_t * ADD_pu8Count);
+
+static void vOvfHandler(void * ADD_pvParam);
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
+/**
+* @brief Timer0 overflow interrupt service routine.
+*/
+void __vector_11(void) __attribute__((signal));
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static boolean bReadCounter(uint32_t * ADD_pu32Overflows, uint8_t * ADD_pu8Count)
+{
+	boolean RET_bPending = FALSE;
+	*ADD_pu32Overflows   = u32Overflows;
+	*ADD_pu8Count        = TCNT0;
+
+	/*the flag is read after the count , a small count means it wrapped before the read*/
+	if((TIFR & (1 << TOV0)) && *ADD_pu8Count < 0x80)
+	{
+		(*ADD_pu32Overflows)++;
+		RET_bPending = TRUE;
+	}
+	return RET_bPending;
+}
+
+static void vOvfHandler(void * ADD_pvParam)
+{
+	u32Overflows++;
+	u32Millis  += US_PER_OVERFLOW / 1000UL;
+	u16FractUs += (uint16_t)(US_PER_OVERFLOW % 1000UL);
+	if(u16FractUs >= 1000)
+	{
+		u16FractUs -= 1000;
+		u32Millis++;
+	}
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+void STIME_vInit(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	u32Overflows = 0;
+	u32Millis    = 0;
+	u16FractUs   = 0;
+
+	#if ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
+	ISR_enuAttach(ISR_VECT_TIMER0_OVF,vOvfHandler,NULL);
+	#endif
+
+	/*Timer0 in normal mode without the output compare pin*/
+	TCCR0 = STIME_PRESCALER;
+	TCNT0 = 0;
+	TIFR  = (1 << TOV0);								/*clear the old flag by writing one*/
+	SET_BIT(TIMSK,TOIE0);
+	CRITICAL_vExit(LOC_u8SREG);
+}
+
+
+uint32_t STIME_u32Micros(void)
+{
+	uint32_t LOC_u32Overflows;
+	uint8_t LOC_u8Count;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the overflow may change the time in the middle*/
+	bReadCounter(&LOC_u32Overflows,&LOC_u8Count);
+	CRITICAL_vExit(LOC_u8SREG);
+	return ((LOC_u32Overflows << 8) | LOC_u8Count) * STIME_US_PER_TICK;
+}
+
+
+uint32_t STIME_u32Millis(void)
+{
+	uint32_t LOC_u32Overflows;
+	uint8_t LOC_u8Count;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the overflow may change the time in the middle*/
+	boolean LOC_bPending = bReadCounter(&LOC_u32Overflows,&LOC_u8Count);
+	uint32_t LOC_u32Millis = u32Millis;
+	uint16_t LOC_u16FractUs = u16FractUs;
+	CRITICAL_vExit(LOC_u8SREG);
+
+	if(LOC_bPending == TRUE)
+	{
+		/*the same as the overflow interrupt will do*/
+		LOC_u32Millis  += US_PER_OVERFLOW / 1000UL;
+		LOC_u16FractUs += (uint16_t)(US_PER_OVERFLOW % 1000UL);
+	}
+	/*the remainder and the count are less than two overflows , a 16-bit division*/
+	LOC_u16FractUs += (uint16_t)LOC_u8Count * (uint16_t)STIME_US_PER_TICK;
+	return LOC_u32Millis + (LOC_u16FractUs / 1000U);
+}
+
+
+STIME_u64Time_t STIME_u64GetUptime(void)
+{
+	uint32_t LOC_u32Overflows;
+	uint8_t LOC_u8Count;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the overflow may change the time in the middle*/
+	bReadCounter(&LOC_u32Overflows,&LOC_u8Count);
+	CRITICAL_vExit(LOC_u8SREG);
+	return ((((STIME_u64Time_t)LOC_u32Overflows) << 8) | LOC_u8Count) * STIME_US_PER_TICK;
+}
+
+
+#if !ISR_IS_DISPATCHED(ISR_VECT_TIMER0_OVF)
+void __vector_11(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER0_OVF);
+	vOvfHandler(NULL);
+	ISR_TRACE_EXIT(ISR_VECT_TIMER0_OVF);
+}
+#endif
@@ -0,0 +1,196 @@
+/******************************************************************************/
+/**
+ * @file STIME.h
+ * @brief system time service API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * system time service. Timer0 runs free in normal mode from the init and its
+ * overflows are counted , the time is the count of the overflows with the
+ * live TCNT0 so it has the resolution of one Timer0 tick and never drifts.
+ * the time is read atomically in micro-seconds , milli-seconds and a 64-bit
+ * uptime which doesn't wrap , the timeouts are checked by the elapsed time
+ * from a start time so they are right across the wrap of the 32-bit values.
+ * Timer0 is owned by this service , TIMER0_ENABLE must be OFF and the Timer0
+ * driver of 04_Timer0 must not be linked with it.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef STIME_H_
+#define STIME_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "STIME_CFG.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+#if TIMER0_KERNEL_ENABLE == ON
+#error Timer0 is the tick of the kernel , the system time and its users are not built with TIMER0_KERNEL_ENABLE ON.
+#endif
+
+/**
+*@brief the division of the CPU clock by the Timer0 prescaler.
+*/
+#define STIME_DIVISION			((STIME_PRESCALER == STIME_CLK_8) ? 8UL : 64UL)
+
+/**
+*@brief the micro-seconds of one Timer0 tick.
+*/
+#define STIME_US_PER_TICK		(STIME_DIVISION / (F_CPU / 1000000UL))
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/**
+*@brief the 64-bit uptime in micro-seconds.
+*@note uint64_t of Platform_Types.h is a long , it is 32-bit on AVR.
+*/
+typedef unsigned long long STIME_u64Time_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief clears the time and starts Timer0 in normal mode with its overflow
+ *	interrupt.
+ *
+ * @note the global interrupt is not enabled here.
+ */
+void STIME_vInit(void);
+
+/**
+ * @brief gets the time from the init in micro-seconds , it wraps after 2^32
+ *	micro-seconds (about 71 minutes).
+ *
+ * @note the resolution is STIME_US_PER_TICK.
+ */
+uint32_t STIME_u32Micros(void);
+
+/**
+ * @brief gets the time from the init in milli-seconds , it wraps after 2^32
+ *	milli-seconds (about 49 days).
+ */
+uint32_t STIME_u32Millis(void);
+
+/**
+ * @brief gets the time from the init in micro-seconds , it doesn't wrap.
+ */
+STIME_u64Time_t STIME_u64GetUptime(void);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				checks if a time passed from a start time.
+ *
+ * @param[in] Copy_u32Start		the start from STIME_u32Millis.
+ *
+ * @param[in] Copy_u32Timeout		the time in milli-seconds , less than 2^31.
+ *
+ * @return TRUE if the time passed.
+ *
+ * @note				it is right across the wrap of STIME_u32Millis.
+ *					EX:- uint32_t LOC_u32Start = STIME_u32Millis();
+ *					     while(!(UCSRA & (1 << RXC)) && !STIME_bIsElapsedMs(LOC_u32Start,100));
+*/
+/*----------------------------------------------------------------------------*/
+static inline boolean STIME_bIsElapsedMs(uint32_t Copy_u32Start, uint32_t Copy_u32Timeout) __attribute__((always_inline));
+static inline boolean STIME_bIsElapsedMs(uint32_t Copy_u32Start, uint32_t Copy_u32Timeout)
+{
+	return ((STIME_u32Millis() - Copy_u32Start) >= Copy_u32Timeout) ? TRUE : FALSE;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				checks if a time passed from a start time.
+ *
+ * @param[in] Copy_u32Start		the start from STIME_u32Micros.
+ *
+ * @param[in] Copy_u32Timeout		the time in micro-seconds , less than 2^31.
+ *
+ * @return TRUE if the time passed.
+*/
+/*----------------------------------------------------------------------------*/
+static inline boolean STIME_bIsElapsedUs(uint32_t Copy_u32Start, uint32_t Copy_u32Timeout) __attribute__((always_inline));
+static inline boolean STIME_bIsElapsedUs(uint32_t Copy_u32Start, uint32_t Copy_u32Timeout)
+{
+	return ((STIME_u32Micros() - Copy_u32Start) >= Copy_u32Timeout) ? TRUE : FALSE;
+}
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* STIME_H_ */
+/******************************************************************************/
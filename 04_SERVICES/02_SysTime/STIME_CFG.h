@@ -0,0 +1,109 @@
+/*******************************************************************************/
+/**
+* @file STIME_CFG.h
+* @brief Header file for system time configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the system time service
+* which counts the time since the init on the Timer0 overflow.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef STIME_CFG_H_
+#define STIME_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   Timer0 prescaler options		              */
+/******************************************************************************/
+
+#define			STIME_CLK_8				2
+#define			STIME_CLK_64				3
+
+/**
+*@brief the clock of Timer0 , it is the resolution of the time. with 8MHz
+*	STIME_CLK_64 gives 8us for each tick and one overflow interrupt every
+*	2.048ms , STIME_CLK_8 gives 1us and one overflow every 256us.
+*@note the division of the prescaler must be a multiple of the CPU clock in MHz.
+*/
+#define			STIME_PRESCALER				STIME_CLK_64
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* STIME_CFG_H_ */
+/******************************************************************************/
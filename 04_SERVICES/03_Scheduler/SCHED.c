@@ -0,0 +1,267 @@
+/******************************************************************************/
+/**
+ * @file SCHED.c
+ * @brief time-triggered cooperative scheduler.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * each task has a down counter of ticks , the tick interrupt decrements them
+ * and sets the bit of the task in the released mask when its counter ends ,
+ * then the counter starts the period again so the releases don't drift. if
+ * the bit is still set the release is an overrun. the dispatcher clears the
+ * bit of the released task of the highest priority , runs it and measures its
+ * time , if the bit is set again when the task returns it was released while
+ * running , that is an overrun too. then it checks the mask again so a higher
+ * priority release waits one task at most.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "SCHED.h"
+#include "SCHED_CFG.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+#if SCHED_EXEC_TIME == SCHED_ON
+#include "../02_SysTime/STIME.h"
+#endif
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief no released task.
+*/
+#define			NONE					0xFF
+
+/******************************************************************************/
+
+#if SCHED_NUMBER_OF_TASKS < 1 || SCHED_NUMBER_OF_TASKS > 32
+#error SCHED_NUMBER_OF_TASKS must be from 1 to 32.
+#endif
+
+#if SCHED_TICK_MS < 1
+#error SCHED_TICK_MS must be 1 at least.
+#endif
+
+#if SCHED_EXEC_TIME != SCHED_ON && SCHED_EXEC_TIME != SCHED_OFF
+#error SCHED_EXEC_TIME configure in wrong way.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/**
+*@brief the bit of the task in the released mask.
+*/
+#define			TASK_BIT(_TASK)				((uint32_t)1 << (_TASK))
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the ticks to the next release of each task.
+*/
+static uint16_t au16Countdown[SCHED_NUMBER_OF_TASKS];
+
+/**
+*@brief the released tasks , a bit for each task.
+*/
+static volatile uint32_t u32Released = 0;
+
+/**
+*@brief the measures of the tasks , the overruns are counted by the tick and
+*	by the dispatcher.
+*/
+static SCHED_stStats_t astStats[SCHED_NUMBER_OF_TASKS];
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief takes the released task of the highest priority and clears its bit.
+*
+* @return the task or NONE.
+*/
+static uint8_t u8TakeReleased(void);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static uint8_t u8TakeReleased(void)
+{
+	uint8_t RET_u8Task = NONE;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the tick sets the bits*/
+	uint32_t LOC_u32Released = u32Released;
+	for(uint8_t LOC_u8Task = 0 ; LOC_u32Released != 0 ; LOC_u8Task++ , LOC_u32Released >>= 1)
+	{
+		if((LOC_u32Released & 1) &&
+		   (RET_u8Task == NONE || SCHED_castTasks[LOC_u8Task].u8Priority < SCHED_castTasks[RET_u8Task].u8Priority))
+		{
+			RET_u8Task = LOC_u8Task;
+		}
+	}
+	if(RET_u8Task != NONE)
+	{
+		u32Released &= ~TASK_BIT(RET_u8Task);
+	}
+	CRITICAL_vExit(LOC_u8SREG);
+	return RET_u8Task;
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+void SCHED_vInit(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	for(uint8_t LOC_u8Task = 0 ; LOC_u8Task < SCHED_NUMBER_OF_TASKS ; LOC_u8Task++)
+	{
+		au16Countdown[LOC_u8Task]        = SCHED_castTasks[LOC_u8Task].u16OffsetTicks + 1;
+		astStats[LOC_u8Task].u32Runs       = 0;
+		astStats[LOC_u8Task].u16Overruns   = 0;
+		astStats[LOC_u8Task].u32LastExecUs = 0;
+		astStats[LOC_u8Task].u32MaxExecUs  = 0;
+	}
+	u32Released = 0;
+	CRITICAL_vExit(LOC_u8SREG);
+}
+
+
+void SCHED_vTick(void * ADD_pvParam)
+{
+	for(uint8_t LOC_u8Task = 0 ; LOC_u8Task < SCHED_NUMBER_OF_TASKS ; LOC_u8Task++)
+	{
+		/*a task of zero period or without a function is never released*/
+		if(SCHED_castTasks[LOC_u8Task].u16PeriodTicks != 0 && SCHED_castTasks[LOC_u8Task].ADD_pfTask != NULL &&
+		   --au16Countdown[LOC_u8Task] == 0)
+		{
+			au16Countdown[LOC_u8Task] = SCHED_castTasks[LOC_u8Task].u16PeriodTicks;
+			if(u32Released & TASK_BIT(LOC_u8Task))
+			{
+				if(astStats[LOC_u8Task].u16Overruns != 0xFFFF)
+				{
+					astStats[LOC_u8Task].u16Overruns++;
+				}
+			}
+			else
+			{
+				u32Released |= TASK_BIT(LOC_u8Task);
+			}
+		}
+	}
+}
+
+
+void SCHED_vDispatch(void)
+{
+	uint8_t LOC_u8Task = u8TakeReleased();
+	while(LOC_u8Task != NONE)
+	{
+		const SCHED_stTask_t * LOC_pstTask = &SCHED_castTasks[LOC_u8Task];
+
+		#if SCHED_EXEC_TIME == SCHED_ON
+		uint32_t LOC_u32Start = STIME_u32Micros();
+		LOC_pstTask->ADD_pfTask(LOC_pstTask->vpParam);
+		uint32_t LOC_u32Exec = STIME_u32Micros() - LOC_u32Start;
+		astStats[LOC_u8Task].u32LastExecUs = LOC_u32Exec;
+		if(LOC_u32Exec > astStats[LOC_u8Task].u32MaxExecUs)
+		{
+			astStats[LOC_u8Task].u32MaxExecUs = LOC_u32Exec;
+		}
+		#else
+		LOC_pstTask->ADD_pfTask(LOC_pstTask->vpParam);
+		#endif
+		astStats[LOC_u8Task].u32Runs++;
+
+		/*the bit was cleared before the run , the tick released the task again while it was running*/
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		if((u32Released & TASK_BIT(LOC_u8Task)) && astStats[LOC_u8Task].u16Overruns != 0xFFFF)
+		{
+			astStats[LOC_u8Task].u16Overruns++;
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+
+		LOC_u8Task = u8TakeReleased();
+	}
+}
+
+
+SCHED_enuErrors_t SCHED_enuGetStats(uint8_t Copy_u8Task, SCHED_stStats_t * ADD_pstStats)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	SCHED_enuErrors_t RET_enuErrorStatus = SCHED_enuOK;
+
+	if(Copy_u8Task >= SCHED_NUMBER_OF_TASKS)
+	{
+		RET_enuErrorStatus = SCHED_enuInvalidTask;
+	}
+	else if(ADD_pstStats == NULL)
+	{
+		RET_enuErrorStatus = SCHED_enuNullPtr;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the tick counts the overruns*/
+		*ADD_pstStats = astStats[Copy_u8Task];
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
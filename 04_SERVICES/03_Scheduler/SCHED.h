@@ -0,0 +1,198 @@
+/******************************************************************************/
+/**
+ * @file SCHED.h
+ * @brief time-triggered scheduler API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * time-triggered cooperative scheduler. the tasks are a static table in
+ * SCHED_CFG.c , each one has a period and an offset in ticks and a priority.
+ * the tick interrupt only releases the tasks whose time came , the main loop
+ * runs the released tasks one by one from the highest priority , a task is
+ * never preempted by another task so it must return quickly. the execution
+ * time of each task and its overruns (a release while the last one has not
+ * run yet or is still running) are measured.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef SCHED_H_
+#define SCHED_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "SCHED_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all scheduler errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     SCHED_enuOK ,
+
+     /**
+     *@brief if you entered a task out of SCHED_NUMBER_OF_TASKS.
+     */
+     SCHED_enuInvalidTask,
+
+    /**
+    *@brief returned if you pass a null pointer to functions.
+    */
+     SCHED_enuNullPtr
+
+} SCHED_enuErrors_t;
+
+
+/*
+*@brief the measures of one task.
+*
+*/
+typedef struct
+{
+     /**
+     *@brief the number of the runs of the task.
+     */
+     uint32_t u32Runs;
+
+     /**
+     *@brief the releases which found the task still waiting or running , each
+     *	one is a missed or late period. it stops at 0xFFFF.
+     */
+     uint16_t u16Overruns;
+
+     /**
+     *@brief the execution time of the last run and the longest one in
+     *	micro-seconds , they are 0 if SCHED_EXEC_TIME is SCHED_OFF.
+     */
+     uint32_t u32LastExecUs;
+     uint32_t u32MaxExecUs;
+
+} SCHED_stStats_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief clears the releases and the measures , the first release of each
+ *	task is after (offset + 1) ticks.
+ *
+ * @note if SCHED_EXEC_TIME is SCHED_ON , STIME_vInit must be called too.
+ */
+void SCHED_vInit(void);
+
+/**
+ * @brief releases the tasks whose time came , it must be called each
+ *	SCHED_TICK_MS from a timer interrupt.
+ *
+ * @param[in] ADD_pvParam	not used , it is here to pass the function as a
+ *				timer callback.
+ *	EX:- Timer_enuSetCallBack(Timer_enuTimer1,SCHED_vTick,NULL);
+ */
+void SCHED_vTick(void * ADD_pvParam);
+
+/**
+ * @brief runs the released tasks , the highest priority first , and returns
+ *	when no task is released.
+ *
+ * @note it is called from the main loop , the CPU can sleep after it until
+ *	the next tick.
+ *	EX:- while(1) { SCHED_vDispatch(); }
+ */
+void SCHED_vDispatch(void);
+
+/**
+ * @brief gets the measures of a task.
+ *
+ * @param[in] Copy_u8Task	the task from 0 to (SCHED_NUMBER_OF_TASKS - 1).
+ *
+ * @param[out] ADD_pstStats	the measures of the task.
+ *
+ * @return the scheduler error status.
+ */
+SCHED_enuErrors_t SCHED_enuGetStats(uint8_t Copy_u8Task, SCHED_stStats_t * ADD_pstStats);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* SCHED_H_ */
+/******************************************************************************/
@@ -0,0 +1,117 @@
+/*******************************************************************************/
+/**
+ * @file SCHED_CFG.c
+ * @brief  the table of the scheduler tasks
+ *
+ * @par Project Name
+ *	AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * this file contains the tasks which you configured their names in SCHED_CFG.h
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "SCHED_CFG.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/************************************************************************/
+/* you should put all tasks configurations here
+/************************************************************************/
+const SCHED_stTask_t SCHED_castTasks[SCHED_NUMBER_OF_TASKS] =
+{
+	[SCHED_TASK_HEARTBEAT] =
+	{
+		.ADD_pfTask     = APP_vHeartbeatTask ,
+		.vpParam        = NULL ,
+		.u16PeriodTicks = 500 / SCHED_TICK_MS ,
+		.u16OffsetTicks = 0 ,
+		.u8Priority     = 0
+	}
+};
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the default heartbeat does nothing , so the table links before the
+*	application is written. define APP_vHeartbeatTask in the application
+*	(EX:- toggle a LED) and it replaces this one.
+*/
+__attribute__((weak)) void APP_vHeartbeatTask(void * ADD_pvParam)
+{
+}
+
+/******************************************************************************/
\ No newline at end of file
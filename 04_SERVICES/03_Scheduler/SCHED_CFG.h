@@ -0,0 +1,148 @@
+/*******************************************************************************/
+/**
+* @file SCHED_CFG.h
+* @brief Header file for the scheduler configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the time-triggered scheduler ,
+* the names of the tasks and the functions of them. the table of the tasks
+* is in SCHED_CFG.c.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef SCHED_CFG_H_
+#define SCHED_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   SCHED Configurations		                      */
+/******************************************************************************/
+
+/**
+*@brief the number of the tasks in the table of SCHED_CFG.c , from 1 to 32.
+*/
+#define			SCHED_NUMBER_OF_TASKS			1
+
+/**
+*@brief the names of the tasks , they are the indexes of the table.
+*/
+#define			SCHED_TASK_HEARTBEAT			0
+
+/**
+*@brief the period of the hardware tick which calls SCHED_vTick in milli-seconds.
+*/
+#define			SCHED_TICK_MS				1
+
+/**
+*@brief SCHED_ON to measure the execution time of each task by the system time
+*	service (Timer0) , SCHED_OFF to not use it.
+*/
+#define			SCHED_ON				1
+#define			SCHED_OFF				0
+
+#define			SCHED_EXEC_TIME				SCHED_ON
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/**
+*@brief one task of the table.
+*/
+typedef struct
+{
+	void (*ADD_pfTask)(void*);			/*the function of the task , it must return*/
+	void * vpParam;					/*generic pointer passed to the task*/
+	uint16_t u16PeriodTicks;			/*the period in ticks of SCHED_TICK_MS*/
+	uint16_t u16OffsetTicks;			/*the tick of the first release , it spreads the tasks of the same period*/
+	uint8_t u8Priority;				/*0 is the highest , a task of the same priority runs by its order in the table*/
+
+} SCHED_stTask_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/**
+*@brief the table of the tasks.
+*/
+extern const SCHED_stTask_t SCHED_castTasks[SCHED_NUMBER_OF_TASKS];
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+*@brief the functions of the tasks , they are defined by the application.
+*	APP_vHeartbeatTask has an empty weak definition in SCHED_CFG.c.
+*/
+void APP_vHeartbeatTask(void * ADD_pvParam);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* SCHED_CFG_H_ */
+/******************************************************************************/
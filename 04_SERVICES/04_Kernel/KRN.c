@@ -0,0 +1,849 @@
+/******************************************************************************/
+/**
+ * @file KRN.c
+ * @brief preemptive priority kernel on the Timer0 compare match.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * each task has a TCB which its first member is the stack pointer of the task
+ * when it doesn't run. a switch pushes a return address , r0 , SREG , r1 and
+ * r2..r31 on the stack of the running task and saves SP in its TCB , selects
+ * the ready task of the highest priority and pops the same frame from its
+ * stack. the tick vector calls the switch as a function so the return address
+ * of a task preempted by the tick is the reti of the vector , a task which
+ * gives the CPU itself returns to its code , so any frame is popped by a ret.
+ * the ready tasks are a bit for each priority and the idle task is always
+ * ready , so the selection is the lowest set bit.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "KRN.h"
+#include "KRN_CFG.h"
+#include "../../00_LIB/BIT_MATH.h"
+#include "../../01_MCAL/02_Interrupt/ISR.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief Timer0 registers.
+*/
+#define			TCCR0					*((volatile uint8_t *)0x53)
+#define			TCNT0					*((volatile uint8_t *)0x52)
+#define			OCR0					*((volatile uint8_t *)0x5C)
+#define			TIMSK					*((volatile uint8_t *)0x59)
+#define			TIFR					*((volatile uint8_t *)0x58)
+
+#define			OCIE0					1
+#define			OCF0					1
+
+/**
+*@brief Timer0 in CTC mode with the prescaler 64.
+*/
+#define			TCCR0_CTC_CLK_64			0x0B
+
+/**
+*@brief the compare value of the tick.
+*/
+#define			TICK_OCR0				((F_CPU / 64UL / KRN_TICK_HZ) - 1UL)
+
+/**
+*@brief the idle task is after the tasks of the user.
+*/
+#define			IDLE_TASK				KRN_MAX_TASKS
+
+/**
+*@brief SREG of a new task , only the global interrupt is enabled.
+*/
+#define			INITIAL_SREG				0x80
+
+/**
+*@brief no waiting task.
+*/
+#define			NONE					0xFF
+
+/******************************************************************************/
+
+#if KRN_MAX_TASKS < 1 || KRN_MAX_TASKS > 7
+#error KRN_MAX_TASKS must be from 1 to 7.
+#endif
+
+#if KRN_STACK_SIZE < 64 || KRN_IDLE_STACK_SIZE < 48
+#error the stacks are too small for the context and the interrupts.
+#endif
+
+#if (F_CPU / 64UL / KRN_TICK_HZ) < 2 || (F_CPU / 64UL / KRN_TICK_HZ) > 256
+#error KRN_TICK_HZ is not generated by Timer0 with the prescaler 64.
+#endif
+
+#if TIMER0_ENABLE == ON
+#error Timer0 is owned by the kernel , TIMER0_ENABLE must be OFF.
+#endif
+
+#if TIMER0_KERNEL_ENABLE == OFF
+#error Timer0 is the tick of the kernel , TIMER0_KERNEL_ENABLE must be ON.
+#endif
+
+#if ISR_IS_DISPATCHED(ISR_VECT_TIMER0_COMP)
+#error the kernel tick switches the stacks , ISR_VECT_TIMER0_COMP must not be dispatched.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/**
+*@brief the bit of a task in the ready mask and the waiters of the semaphores.
+*/
+#define			TASK_BIT(_TASK)				((uint8_t)(1 << (_TASK)))
+
+/**
+*@brief pushes the context of the running task and saves SP in its TCB.
+*/
+#define SAVE_CONTEXT()								\
+	__asm__ __volatile__ (	"push	r0				\n\t"	\
+				"in	r0 , __SREG__			\n\t"	\
+				"cli					\n\t"	\
+				"push	r0				\n\t"	\
+				"push	r1				\n\t"	\
+				"clr	r1				\n\t"	\
+				"push	r2				\n\t"	\
+				"push	r3				\n\t"	\
+				"push	r4				\n\t"	\
+				"push	r5				\n\t"	\
+				"push	r6				\n\t"	\
+				"push	r7				\n\t"	\
+				"push	r8				\n\t"	\
+				"push	r9				\n\t"	\
+				"push	r10				\n\t"	\
+				"push	r11				\n\t"	\
+				"push	r12				\n\t"	\
+				"push	r13				\n\t"	\
+				"push	r14				\n\t"	\
+				"push	r15				\n\t"	\
+				"push	r16				\n\t"	\
+				"push	r17				\n\t"	\
+				"push	r18				\n\t"	\
+				"push	r19				\n\t"	\
+				"push	r20				\n\t"	\
+				"push	r21				\n\t"	\
+				"push	r22				\n\t"	\
+				"push	r23				\n\t"	\
+				"push	r24				\n\t"	\
+				"push	r25				\n\t"	\
+				"push	r26				\n\t"	\
+				"push	r27				\n\t"	\
+				"push	r28				\n\t"	\
+				"push	r29				\n\t"	\
+				"push	r30				\n\t"	\
+				"push	r31				\n\t"	\
+				"lds	r26 , KRN_pstCurrentTCB		\n\t"	\
+				"lds	r27 , KRN_pstCurrentTCB + 1	\n\t"	\
+				"in	r0 , __SP_L__			\n\t"	\
+				"st	x+ , r0				\n\t"	\
+				"in	r0 , __SP_H__			\n\t"	\
+				"st	x+ , r0				\n\t"	\
+			     )
+
+/**
+*@brief loads SP from the TCB of the selected task and pops its context.
+*/
+#define RESTORE_CONTEXT()							\
+	__asm__ __volatile__ (	"lds	r26 , KRN_pstCurrentTCB		\n\t"	\
+				"lds	r27 , KRN_pstCurrentTCB + 1	\n\t"	\
+				"ld	r28 , x+			\n\t"	\
+				"out	__SP_L__ , r28			\n\t"	\
+				"ld	r29 , x+			\n\t"	\
+				"out	__SP_H__ , r29			\n\t"	\
+				"pop	r31				\n\t"	\
+				"pop	r30				\n\t"	\
+				"pop	r29				\n\t"	\
+				"pop	r28				\n\t"	\
+				"pop	r27				\n\t"	\
+				"pop	r26				\n\t"	\
+				"pop	r25				\n\t"	\
+				"pop	r24				\n\t"	\
+				"pop	r23				\n\t"	\
+				"pop	r22				\n\t"	\
+				"pop	r21				\n\t"	\
+				"pop	r20				\n\t"	\
+				"pop	r19				\n\t"	\
+				"pop	r18				\n\t"	\
+				"pop	r17				\n\t"	\
+				"pop	r16				\n\t"	\
+				"pop	r15				\n\t"	\
+				"pop	r14				\n\t"	\
+				"pop	r13				\n\t"	\
+				"pop	r12				\n\t"	\
+				"pop	r11				\n\t"	\
+				"pop	r10				\n\t"	\
+				"pop	r9				\n\t"	\
+				"pop	r8				\n\t"	\
+				"pop	r7				\n\t"	\
+				"pop	r6				\n\t"	\
+				"pop	r5				\n\t"	\
+				"pop	r4				\n\t"	\
+				"pop	r3				\n\t"	\
+				"pop	r2				\n\t"	\
+				"pop	r1				\n\t"	\
+				"pop	r0				\n\t"	\
+				"out	__SREG__ , r0			\n\t"	\
+				"pop	r0				\n\t"	\
+			     )
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/**
+*@brief the task control block.
+*/
+typedef struct
+{
+	/**
+	*@brief SP of the task when it doesn't run , it must be the first member.
+	*/
+	volatile uint16_t u16SP;
+
+	/**
+	*@brief the ticks to wake the task , 0 if it doesn't wait a time.
+	*/
+	volatile uint16_t u16Delay;
+
+	void (*pfTask)(void*);
+	void * pvParam;
+
+	/**
+	*@brief the semaphore which the task waits on it or NULL.
+	*/
+	KRN_stSem_t * volatile pstWaitSem;
+
+	/**
+	*@brief set by the tick if the wait on the semaphore timed out.
+	*/
+	volatile boolean bTimedOut;
+
+	boolean bCreated;
+
+} stTCB_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the tasks and the idle task at the end.
+*/
+static stTCB_t astTCB[KRN_MAX_TASKS + 1];
+
+/**
+*@brief the stacks of the tasks.
+*/
+static uint8_t au8Stacks[KRN_MAX_TASKS][KRN_STACK_SIZE];
+static uint8_t au8IdleStack[KRN_IDLE_STACK_SIZE];
+
+/**
+*@brief the ready tasks , a bit for each priority , the bit of the idle task
+*	is always set.
+*/
+static volatile uint8_t u8ReadyMask = TASK_BIT(IDLE_TASK);
+
+/**
+*@brief the running task.
+*/
+static volatile uint8_t u8Current = IDLE_TASK;
+
+/**
+*@brief the ticks from KRN_vStart.
+*/
+static volatile uint32_t u32Ticks = 0;
+
+static boolean bStarted = FALSE;
+
+/**
+*@brief set by the ISR functions when the woken task is higher than the running
+*	task , KRN_vYieldFromISR switches to it and any selection clears it.
+*/
+static volatile boolean bSwitchPending = FALSE;
+
+/**
+*@brief the TCB of the running task , it is not static because the context
+*	macros read it by its name.
+*/
+stTCB_t * volatile KRN_pstCurrentTCB __attribute__((used)) = &astTCB[IDLE_TASK];
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief builds the first frame of a task on its stack , it is popped as the
+*	task was switched out at the start of vTaskEntry.
+*/
+static void vInitStack(uint8_t Copy_u8Task, uint8_t * ADD_pu8Stack, uint16_t Copy_u16Size);
+
+/**
+* @brief the start of each task , it calls the task function and stops the
+*	task if the function returns.
+*/
+static void vTaskEntry(void);
+
+static void vIdleTask(void * ADD_pvParam);
+
+/**
+* @brief selects the ready task of the highest priority , called with the
+*	interrupts disabled.
+*/
+static void vSelect(void);
+
+/**
+* @brief gives the semaphore to the waiting task of the highest priority or
+*	increments its count , called with the interrupts disabled.
+*
+* @return the woken task or NONE.
+*/
+static uint8_t u8SemRelease(KRN_stSem_t * ADD_pstSem);
+
+static void vTickHandler(void);
+
+/**
+* @brief saves the running task , runs the tick and restores the selected task.
+*/
+static void vTickSwitch(void) __attribute__((naked, noinline));
+
+/**
+* @brief restores the first task , it doesn't return to its caller.
+*/
+static void vStartFirstTask(void) __attribute__((naked, noinline));
+
+/**
+* @brief KRN_vYield saves and restores the context itself.
+*/
+void KRN_vYield(void) __attribute__((naked, noinline));
+
+/**
+* @brief Timer0 compare match interrupt service routine.
+*/
+void __vector_10(void) __attribute__((signal, naked));
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static void vInitStack(uint8_t Copy_u8Task, uint8_t * ADD_pu8Stack, uint16_t Copy_u16Size)
+{
+	uint8_t * LOC_pu8Top = &ADD_pu8Stack[Copy_u16Size - 1];
+	uint16_t LOC_u16Entry = (uint16_t)vTaskEntry;				/*the word address of the function*/
+
+	/*the return address , the low byte is at the higher address*/
+	*LOC_pu8Top-- = (uint8_t)LOC_u16Entry;
+	*LOC_pu8Top-- = (uint8_t)(LOC_u16Entry >> 8);
+
+	*LOC_pu8Top-- = 0;								/*r0*/
+	*LOC_pu8Top-- = INITIAL_SREG;
+	for(uint8_t LOC_u8Reg = 1 ; LOC_u8Reg < 32 ; LOC_u8Reg++)
+	{
+		*LOC_pu8Top-- = 0;							/*r1 must be zero*/
+	}
+
+	/*SP points to the free byte under the frame*/
+	astTCB[Copy_u8Task].u16SP = (uint16_t)LOC_pu8Top;
+}
+
+static void vTaskEntry(void)
+{
+	KRN_pstCurrentTCB->pfTask(KRN_pstCurrentTCB->pvParam);
+
+	/*the task returned , it never becomes ready again*/
+	CRITICAL_u8Enter();
+	u8ReadyMask &= (uint8_t)~TASK_BIT(u8Current);
+	while(1)
+	{
+		KRN_vYield();
+	}
+}
+
+static void vIdleTask(void * ADD_pvParam)
+{
+	while(1)
+	{
+		/*a task woken by an interrupt runs without waiting the tick*/
+		if(u8ReadyMask & (uint8_t)~TASK_BIT(IDLE_TASK))
+		{
+			KRN_vYield();
+		}
+	}
+}
+
+static void vSelect(void)
+{
+	uint8_t LOC_u8Ready = u8ReadyMask;
+	uint8_t LOC_u8Task  = 0;
+	while((LOC_u8Ready & 1) == 0)
+	{
+		LOC_u8Ready >>= 1;
+		LOC_u8Task++;
+	}
+	u8Current         = LOC_u8Task;
+	KRN_pstCurrentTCB = &astTCB[LOC_u8Task];
+	bSwitchPending    = FALSE;
+}
+
+static uint8_t u8SemRelease(KRN_stSem_t * ADD_pstSem)
+{
+	uint8_t RET_u8Task = NONE;
+	if(ADD_pstSem->u8Waiters != 0)
+	{
+		/*the count is handed to the highest waiter directly*/
+		RET_u8Task = 0;
+		while((ADD_pstSem->u8Waiters & TASK_BIT(RET_u8Task)) == 0)
+		{
+			RET_u8Task++;
+		}
+		ADD_pstSem->u8Waiters &= (uint8_t)~TASK_BIT(RET_u8Task);
+		astTCB[RET_u8Task].pstWaitSem = NULL;
+		astTCB[RET_u8Task].u16Delay   = 0;
+		u8ReadyMask |= TASK_BIT(RET_u8Task);
+	}
+	else if(ADD_pstSem->u8Count != 0xFF)
+	{
+		ADD_pstSem->u8Count++;
+	}
+	return RET_u8Task;
+}
+
+static void vTickHandler(void)
+{
+	ISR_TRACE_ENTER(ISR_VECT_TIMER0_COMP);
+	u32Ticks++;
+	for(uint8_t LOC_u8Task = 0 ; LOC_u8Task < KRN_MAX_TASKS ; LOC_u8Task++)
+	{
+		if(astTCB[LOC_u8Task].u16Delay != 0 && --astTCB[LOC_u8Task].u16Delay == 0)
+		{
+			if(astTCB[LOC_u8Task].pstWaitSem != NULL)
+			{
+				astTCB[LOC_u8Task].pstWaitSem->u8Waiters &= (uint8_t)~TASK_BIT(LOC_u8Task);
+				astTCB[LOC_u8Task].pstWaitSem = NULL;
+				astTCB[LOC_u8Task].bTimedOut  = TRUE;
+			}
+			u8ReadyMask |= TASK_BIT(LOC_u8Task);
+		}
+	}
+	vSelect();
+	ISR_TRACE_EXIT(ISR_VECT_TIMER0_COMP);
+}
+
+static void vTickSwitch(void)
+{
+	SAVE_CONTEXT();
+	vTickHandler();
+	RESTORE_CONTEXT();
+	__asm__ __volatile__ ("ret");
+}
+
+static void vStartFirstTask(void)
+{
+	RESTORE_CONTEXT();
+	__asm__ __volatile__ ("ret");
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+KRN_enuErrors_t KRN_enuCreateTask(uint8_t Copy_u8Priority, void (*ADD_pfTask)(void*), void * ADD_pvParam)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(Copy_u8Priority >= KRN_MAX_TASKS || astTCB[Copy_u8Priority].bCreated == TRUE || bStarted == TRUE)
+	{
+		RET_enuErrorStatus = KRN_enuInvalidTask;
+	}
+	else if(ADD_pfTask == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		astTCB[Copy_u8Priority].pfTask     = ADD_pfTask;
+		astTCB[Copy_u8Priority].pvParam    = ADD_pvParam;
+		astTCB[Copy_u8Priority].u16Delay   = 0;
+		astTCB[Copy_u8Priority].pstWaitSem = NULL;
+		astTCB[Copy_u8Priority].bTimedOut  = FALSE;
+		astTCB[Copy_u8Priority].bCreated   = TRUE;
+		vInitStack(Copy_u8Priority,au8Stacks[Copy_u8Priority],KRN_STACK_SIZE);
+		u8ReadyMask |= TASK_BIT(Copy_u8Priority);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+void KRN_vStart(void)
+{
+	CRITICAL_u8Enter();								/*the first task enables it*/
+
+	astTCB[IDLE_TASK].pfTask   = vIdleTask;
+	astTCB[IDLE_TASK].pvParam  = NULL;
+	astTCB[IDLE_TASK].bCreated = TRUE;
+	vInitStack(IDLE_TASK,au8IdleStack,KRN_IDLE_STACK_SIZE);
+
+	u32Ticks = 0;
+	TCCR0 = TCCR0_CTC_CLK_64;
+	OCR0  = (uint8_t)TICK_OCR0;
+	TCNT0 = 0;
+	TIFR  = (1 << OCF0);								/*clear the old flag by writing one*/
+	SET_BIT(TIMSK,OCIE0);
+
+	bStarted = TRUE;
+	vSelect();
+	vStartFirstTask();
+}
+
+
+void KRN_vDelay(uint16_t Copy_u16Ticks)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	if(Copy_u16Ticks != 0)
+	{
+		astTCB[u8Current].u16Delay = Copy_u16Ticks;
+		u8ReadyMask &= (uint8_t)~TASK_BIT(u8Current);
+	}
+	KRN_vYield();
+	CRITICAL_vExit(LOC_u8SREG);
+}
+
+
+void KRN_vYield(void)
+{
+	SAVE_CONTEXT();
+	vSelect();
+	RESTORE_CONTEXT();
+	__asm__ __volatile__ ("ret");
+}
+
+
+void KRN_vYieldFromISR(void)
+{
+	/*the interrupts are disabled in the ISR , the frame of the interrupt stays on the stack of the
+	  interrupted task and its reti runs when that task is selected again*/
+	if(bSwitchPending == TRUE)
+	{
+		KRN_vYield();
+	}
+}
+
+
+uint32_t KRN_u32GetTicks(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the tick may change it in the middle*/
+	uint32_t LOC_u32Ticks = u32Ticks;
+	CRITICAL_vExit(LOC_u8SREG);
+	return LOC_u32Ticks;
+}
+
+
+KRN_enuErrors_t KRN_enuSemInit(KRN_stSem_t * ADD_pstSem, uint8_t Copy_u8Count)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstSem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		ADD_pstSem->u8Count   = Copy_u8Count;
+		ADD_pstSem->u8Waiters = 0;
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuSemTake(KRN_stSem_t * ADD_pstSem, uint16_t Copy_u16Timeout)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstSem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		if(ADD_pstSem->u8Count != 0)
+		{
+			ADD_pstSem->u8Count--;
+		}
+		else if(Copy_u16Timeout == KRN_NO_WAIT)
+		{
+			RET_enuErrorStatus = KRN_enuTimeout;
+		}
+		else
+		{
+			stTCB_t * LOC_pstTCB = &astTCB[u8Current];
+			ADD_pstSem->u8Waiters |= TASK_BIT(u8Current);
+			LOC_pstTCB->pstWaitSem = ADD_pstSem;
+			LOC_pstTCB->bTimedOut  = FALSE;
+			LOC_pstTCB->u16Delay   = (Copy_u16Timeout == KRN_WAIT_FOREVER) ? 0 : Copy_u16Timeout;
+			u8ReadyMask &= (uint8_t)~TASK_BIT(u8Current);
+
+			/*returns when the semaphore is given or the tick ends the wait*/
+			KRN_vYield();
+			if(LOC_pstTCB->bTimedOut == TRUE)
+			{
+				RET_enuErrorStatus = KRN_enuTimeout;
+			}
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuSemGive(KRN_stSem_t * ADD_pstSem)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstSem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		uint8_t LOC_u8Task = u8SemRelease(ADD_pstSem);
+		if(bStarted == TRUE && LOC_u8Task < u8Current)
+		{
+			KRN_vYield();
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuSemGiveISR(KRN_stSem_t * ADD_pstSem)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstSem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		uint8_t LOC_u8Task = u8SemRelease(ADD_pstSem);
+		if(bStarted == TRUE && LOC_u8Task < u8Current)
+		{
+			bSwitchPending = TRUE;
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuQueueInit(KRN_stQueue_t * ADD_pstQueue, void * ADD_pvBuffer,
+				 uint8_t Copy_u8ItemSize, uint8_t Copy_u8Length)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstQueue == NULL || ADD_pvBuffer == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else if(Copy_u8ItemSize == 0 || Copy_u8Length == 0)
+	{
+		RET_enuErrorStatus = KRN_enuInvalidSize;
+	}
+	else
+	{
+		ADD_pstQueue->pu8Buffer  = (uint8_t *)ADD_pvBuffer;
+		ADD_pstQueue->u8ItemSize = Copy_u8ItemSize;
+		ADD_pstQueue->u8Length   = Copy_u8Length;
+		ADD_pstQueue->u8Head     = 0;
+		ADD_pstQueue->u8Tail     = 0;
+		KRN_enuSemInit(&ADD_pstQueue->stItems,0);
+		KRN_enuSemInit(&ADD_pstQueue->stSpaces,Copy_u8Length);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuQueueSend(KRN_stQueue_t * ADD_pstQueue, const void * ADD_pvItem, uint16_t Copy_u16Timeout)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstQueue == NULL || ADD_pvItem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		RET_enuErrorStatus = KRN_enuSemTake(&ADD_pstQueue->stSpaces,Copy_u16Timeout);
+		if(RET_enuErrorStatus == KRN_enuOK)
+		{
+			uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*the interrupts send to the same queue*/
+			uint8_t * LOC_pu8Slot = &ADD_pstQueue->pu8Buffer[ADD_pstQueue->u8Head * ADD_pstQueue->u8ItemSize];
+			for(uint8_t LOC_u8Byte = 0 ; LOC_u8Byte < ADD_pstQueue->u8ItemSize ; LOC_u8Byte++)
+			{
+				LOC_pu8Slot[LOC_u8Byte] = ((const uint8_t *)ADD_pvItem)[LOC_u8Byte];
+			}
+			ADD_pstQueue->u8Head = (ADD_pstQueue->u8Head + 1 == ADD_pstQueue->u8Length) ? 0 : ADD_pstQueue->u8Head + 1;
+			CRITICAL_vExit(LOC_u8SREG);
+			KRN_enuSemGive(&ADD_pstQueue->stItems);
+		}
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuQueueSendISR(KRN_stQueue_t * ADD_pstQueue, const void * ADD_pvItem)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstQueue == NULL || ADD_pvItem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+		if(ADD_pstQueue->stSpaces.u8Count == 0)
+		{
+			RET_enuErrorStatus = KRN_enuFull;
+		}
+		else
+		{
+			ADD_pstQueue->stSpaces.u8Count--;
+			uint8_t * LOC_pu8Slot = &ADD_pstQueue->pu8Buffer[ADD_pstQueue->u8Head * ADD_pstQueue->u8ItemSize];
+			for(uint8_t LOC_u8Byte = 0 ; LOC_u8Byte < ADD_pstQueue->u8ItemSize ; LOC_u8Byte++)
+			{
+				LOC_pu8Slot[LOC_u8Byte] = ((const uint8_t *)ADD_pvItem)[LOC_u8Byte];
+			}
+			ADD_pstQueue->u8Head = (ADD_pstQueue->u8Head + 1 == ADD_pstQueue->u8Length) ? 0 : ADD_pstQueue->u8Head + 1;
+			uint8_t LOC_u8Task = u8SemRelease(&ADD_pstQueue->stItems);
+			if(bStarted == TRUE && LOC_u8Task < u8Current)
+			{
+				bSwitchPending = TRUE;
+			}
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+KRN_enuErrors_t KRN_enuQueueReceive(KRN_stQueue_t * ADD_pstQueue, void * ADD_pvItem, uint16_t Copy_u16Timeout)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	KRN_enuErrors_t RET_enuErrorStatus = KRN_enuOK;
+
+	if(ADD_pstQueue == NULL || ADD_pvItem == NULL)
+	{
+		RET_enuErrorStatus = KRN_enuNullPtr;
+	}
+	else
+	{
+		RET_enuErrorStatus = KRN_enuSemTake(&ADD_pstQueue->stItems,Copy_u16Timeout);
+		if(RET_enuErrorStatus == KRN_enuOK)
+		{
+			uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+			const uint8_t * LOC_pu8Slot = &ADD_pstQueue->pu8Buffer[ADD_pstQueue->u8Tail * ADD_pstQueue->u8ItemSize];
+			for(uint8_t LOC_u8Byte = 0 ; LOC_u8Byte < ADD_pstQueue->u8ItemSize ; LOC_u8Byte++)
+			{
+				((uint8_t *)ADD_pvItem)[LOC_u8Byte] = LOC_pu8Slot[LOC_u8Byte];
+			}
+			ADD_pstQueue->u8Tail = (ADD_pstQueue->u8Tail + 1 == ADD_pstQueue->u8Length) ? 0 : ADD_pstQueue->u8Tail + 1;
+			CRITICAL_vExit(LOC_u8SREG);
+			KRN_enuSemGive(&ADD_pstQueue->stSpaces);
+		}
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+void __vector_10(void)
+{
+	/*the switch is called so its frame returns to this reti*/
+	vTickSwitch();
+	__asm__ __volatile__ ("reti");
+}
@@ -0,0 +1,306 @@
+/******************************************************************************/
+/**
+ * @file KRN.h
+ * @brief preemptive kernel API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * preemptive kernel. each task has a static stack and a fixed priority which
+ * is its number , the highest ready task always runs. the Timer0 compare
+ * match is the tick , it saves the 32 registers and SREG of the running task
+ * on its stack , counts the delays and restores the highest ready task. a task
+ * waits on a delay , a semaphore or a queue without using the CPU , the
+ * interrupts (the UART and TWI completion callbacks for example) wake it by
+ * the ISR functions and switch to it at once by KRN_vYieldFromISR.
+ * Timer0 is owned by this kernel , TIMER0_ENABLE must be OFF and
+ * TIMER0_KERNEL_ENABLE must be ON , then the system time service (and the
+ * protothreads , the scheduler and the CPU load which use it) stops the build.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef KRN_H_
+#define KRN_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "KRN_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the timeout which waits until the semaphore is given.
+*/
+#define KRN_WAIT_FOREVER		0xFFFF
+
+/**
+*@brief the timeout which doesn't wait.
+*/
+#define KRN_NO_WAIT			0
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief converts milli-seconds to kernel ticks , rounded up to one tick at least.
+*	EX:- KRN_vDelay(KRN_MS_TO_TICKS(10));
+*/
+#define KRN_MS_TO_TICKS(_MS)		((uint16_t)((((uint32_t)(_MS) * KRN_TICK_HZ) + 999UL) / 1000UL))
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all kernel errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     KRN_enuOK ,
+
+     /**
+     *@brief if you entered a priority out of KRN_MAX_TASKS or it has a task.
+     */
+     KRN_enuInvalidTask,
+
+     /**
+     *@brief if the semaphore or the queue is not given before the timeout.
+     */
+     KRN_enuTimeout,
+
+     /**
+     *@brief if the queue is full and the function can't wait (from an interrupt).
+     */
+     KRN_enuFull,
+
+     /**
+     *@brief if you entered a zero item size or a zero length.
+     */
+     KRN_enuInvalidSize,
+
+    /**
+    *@brief returned if you pass a null pointer to functions.
+    */
+     KRN_enuNullPtr
+
+} KRN_enuErrors_t;
+
+
+/*
+*@brief a counting semaphore , the waiting tasks are a bit for each priority.
+*
+*/
+typedef struct
+{
+     volatile uint8_t u8Count;
+     volatile uint8_t u8Waiters;
+
+} KRN_stSem_t;
+
+
+/*
+*@brief a queue of fixed size items copied into a buffer of the user , the
+*	items and the free places are counted by two semaphores.
+*
+*/
+typedef struct
+{
+     uint8_t * pu8Buffer;
+     uint8_t u8ItemSize;
+     uint8_t u8Length;
+     uint8_t u8Head;
+     uint8_t u8Tail;
+     KRN_stSem_t stItems;
+     KRN_stSem_t stSpaces;
+
+} KRN_stQueue_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief creates a task , it is called before KRN_vStart.
+ *
+ * @param[in] Copy_u8Priority	the priority and the number of the task from 0
+ *				(the highest) to (KRN_MAX_TASKS - 1).
+ *
+ * @param[in] ADD_pfTask	the function of the task , if it returns the task
+ *				stops.
+ *
+ * @param[in] ADD_pvParam	generic pointer passed to the task.
+ *
+ * @return the kernel error status.
+ */
+KRN_enuErrors_t KRN_enuCreateTask(uint8_t Copy_u8Priority, void (*ADD_pfTask)(void*), void * ADD_pvParam);
+
+/**
+ * @brief starts the tick and the highest task , it doesn't return.
+ *
+ * @note the global interrupt is enabled by the first task , the stack of
+ *	main is not used after it.
+ */
+void KRN_vStart(void);
+
+/**
+ * @brief the running task waits some ticks , the lower tasks run meanwhile.
+ */
+void KRN_vDelay(uint16_t Copy_u16Ticks);
+
+/**
+ * @brief the running task gives the CPU to the highest ready task.
+ */
+void KRN_vYield(void);
+
+/**
+ * @brief switches to the task woken by KRN_enuSemGiveISR or KRN_enuQueueSendISR
+ *	if it is higher than the interrupted task , else it does nothing.
+ *
+ * @note it is called from the interrupts only as the last statement of the
+ *	completion callback (UART , TWI , ...) , without it the woken task waits
+ *	the next tick unless the CPU is idle.
+ */
+void KRN_vYieldFromISR(void);
+
+/**
+ * @brief gets the ticks from KRN_vStart.
+ */
+uint32_t KRN_u32GetTicks(void);
+
+/**
+ * @brief sets the initial count of a semaphore , 0 to signal events and 1
+ *	to lock a resource.
+ */
+KRN_enuErrors_t KRN_enuSemInit(KRN_stSem_t * ADD_pstSem, uint8_t Copy_u8Count);
+
+/**
+ * @brief takes the semaphore , the task waits if its count is zero.
+ *
+ * @param[in] ADD_pstSem	the semaphore.
+ *
+ * @param[in] Copy_u16Timeout	the ticks to wait , KRN_NO_WAIT or KRN_WAIT_FOREVER.
+ *
+ * @return KRN_enuOK or KRN_enuTimeout.
+ *
+ * @note it is called from the tasks only.
+ */
+KRN_enuErrors_t KRN_enuSemTake(KRN_stSem_t * ADD_pstSem, uint16_t Copy_u16Timeout);
+
+/**
+ * @brief gives the semaphore to the highest waiting task or increments its
+ *	count , the task runs now if it is higher than the running task.
+ *
+ * @note it is called from the tasks only.
+ */
+KRN_enuErrors_t KRN_enuSemGive(KRN_stSem_t * ADD_pstSem);
+
+/**
+ * @brief gives the semaphore from an interrupt , a higher waiting task runs
+ *	when the callback calls KRN_vYieldFromISR.
+ *	EX:- static void vTwiDone(void) { KRN_enuSemGiveISR(&stTwiSem); KRN_vYieldFromISR(); }
+ */
+KRN_enuErrors_t KRN_enuSemGiveISR(KRN_stSem_t * ADD_pstSem);
+
+/**
+ * @brief sets the buffer of a queue , it must be (Copy_u8ItemSize * Copy_u8Length) bytes.
+ */
+KRN_enuErrors_t KRN_enuQueueInit(KRN_stQueue_t * ADD_pstQueue, void * ADD_pvBuffer,
+				 uint8_t Copy_u8ItemSize, uint8_t Copy_u8Length);
+
+/**
+ * @brief copies an item to the queue , the task waits while the queue is full.
+ *
+ * @note it is called from the tasks only.
+ */
+KRN_enuErrors_t KRN_enuQueueSend(KRN_stQueue_t * ADD_pstQueue, const void * ADD_pvItem, uint16_t Copy_u16Timeout);
+
+/**
+ * @brief copies an item to the queue from an interrupt , KRN_enuFull if there
+ *	is no place. a higher waiting task runs when the callback calls KRN_vYieldFromISR.
+ *	EX:- static void vRxDone(void * pvBuff, uint16_t u16Len) { KRN_enuQueueSendISR(&stRxQueue,pvBuff); KRN_vYieldFromISR(); }
+ */
+KRN_enuErrors_t KRN_enuQueueSendISR(KRN_stQueue_t * ADD_pstQueue, const void * ADD_pvItem);
+
+/**
+ * @brief copies the oldest item from the queue , the task waits while the
+ *	queue is empty.
+ *
+ * @note it is called from the tasks only.
+ */
+KRN_enuErrors_t KRN_enuQueueReceive(KRN_stQueue_t * ADD_pstQueue, void * ADD_pvItem, uint16_t Copy_u16Timeout);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* KRN_H_ */
+/******************************************************************************/
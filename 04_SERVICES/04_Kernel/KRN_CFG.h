@@ -0,0 +1,122 @@
+/*******************************************************************************/
+/**
+* @file KRN_CFG.h
+* @brief Header file for preemptive kernel configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the preemptive kernel , the
+* number of the tasks , their stacks and the tick on the Timer0 compare match.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef KRN_CFG_H_
+#define KRN_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   KRN Configurations		                      */
+/******************************************************************************/
+
+/**
+*@brief the number of the tasks without the idle task , from 1 to 7. the
+*	priority of a task is its number , 0 is the highest.
+*/
+#define			KRN_MAX_TASKS				4
+
+/**
+*@brief the stack of each task in bytes , it holds the context (35 bytes) , the
+*	calls of the task and the interrupts which come while it runs , an
+*	interrupt which calls KRN_vYieldFromISR keeps its frame and a second
+*	context on it until the task runs again.
+*/
+#define			KRN_STACK_SIZE				160
+
+/**
+*@brief the stack of the idle task in bytes.
+*/
+#define			KRN_IDLE_STACK_SIZE			80
+
+/**
+*@brief the tick frequency in Hz , Timer0 is in CTC mode with the prescaler 64.
+*/
+#define			KRN_TICK_HZ				1000UL
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* KRN_CFG_H_ */
+/******************************************************************************/
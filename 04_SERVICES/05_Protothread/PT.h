@@ -0,0 +1,284 @@
+/******************************************************************************/
+/**
+ * @file PT.h
+ * @brief protothreads API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides the macros of the stackless protothreads. a
+ * protothread is a function which is written as a sequence with waits in it ,
+ * each wait saves the line of the wait in the thread and returns , the next
+ * call jumps to the same line by a switch on it. so a sequence of a driver or
+ * the application doesn't block the CPU and its state is the thread (6 bytes)
+ * instead of a stack.
+ * the local variables are lost at each wait , keep them static or in the
+ * structure of the sequence , don't use a switch inside the thread and
+ * don't put two waits in the same line.
+ *
+ * @par EX:-
+ *	static PT_stThread_t stBlink;
+ *	static PT_Event_t    Btn;
+ *	static PT_enuStates_t enuBlink(PT_stThread_t * ADD_pstPT)
+ *	{
+ *		PT_BEGIN(ADD_pstPT);
+ *		while(1)
+ *		{
+ *			PT_WAIT_EVENT(ADD_pstPT,&Btn);		(set by PT_vSignal(&Btn) in an interrupt)
+ *			LED_enuSetLedState(LED_1,LED_ON);
+ *			PT_WAIT_MS(ADD_pstPT,500);
+ *			LED_enuSetLedState(LED_1,LED_OFF);
+ *		}
+ *		PT_END(ADD_pstPT);
+ *	}
+ *	main :	PT_INIT(&stBlink); while(1) { enuBlink(&stBlink); }
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef PT_H_
+#define PT_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+#include "PT_CFG.h"
+#include PT_CLOCK_HEADER
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief starts the thread from its first line , it is called before the first
+*	run and to run a finished thread again.
+*/
+#define PT_INIT(_PT)				((_PT)->u16Line = 0)
+
+/**
+*@brief the first line in the function of the thread , it jumps to the last wait.
+*/
+#define PT_BEGIN(_PT)				{ uint8_t PT_u8Yielded = 0; (void)PT_u8Yielded;	\
+						  switch((_PT)->u16Line) { case 0:
+
+/**
+*@brief the last line in the function of the thread , the thread is started
+*	again at the next call.
+*/
+#define PT_END(_PT)				} PT_INIT(_PT); return PT_enuEnded; }
+
+/**
+*@brief returns until the condition becomes true , it is checked at each call.
+*/
+#define PT_WAIT_UNTIL(_PT,_COND)		do { (_PT)->u16Line = __LINE__; case __LINE__:		\
+						     if(!(_COND)) { return PT_enuWaiting; } } while(0)
+
+/**
+*@brief returns while the condition is true.
+*/
+#define PT_WAIT_WHILE(_PT,_COND)		PT_WAIT_UNTIL((_PT),!(_COND))
+
+/**
+*@brief returns until some milli-seconds pass from now , at least _MS and at
+*	most _MS + 1 (the resolution of PT_GET_MS).
+*/
+#define PT_WAIT_MS(_PT,_MS)			do { (_PT)->u32Start = PT_GET_MS();			\
+						     PT_WAIT_UNTIL((_PT),(PT_GET_MS() - (_PT)->u32Start) > (uint32_t)(_MS)); } while(0)
+
+/**
+*@brief returns until the event is signaled and clears it.
+*/
+#define PT_WAIT_EVENT(_PT,_EVT)			PT_WAIT_UNTIL((_PT),PT_bTakeEvent(_EVT) == TRUE)
+
+/**
+*@brief returns once , the other threads run before the next line.
+*/
+#define PT_YIELD(_PT)				do { PT_u8Yielded = 1; (_PT)->u16Line = __LINE__; case __LINE__:	\
+						     if(PT_u8Yielded != 0) { return PT_enuYielded; } } while(0)
+
+/**
+*@brief runs a child thread until it finishes , the child is a sequence which
+*	is used by more than one thread.
+*	EX:- PT_SPAWN(ADD_pstPT,&stChild,enuChild(&stChild,u8Arg));
+*/
+#define PT_SPAWN(_PT,_CHILD,_CALL)		do { PT_INIT(_CHILD); PT_WAIT_UNTIL((_PT),(_CALL) >= PT_enuExited); } while(0)
+
+/**
+*@brief ends the thread now , it is started again at the next call.
+*/
+#define PT_EXIT(_PT)				do { PT_INIT(_PT); return PT_enuExited; } while(0)
+
+/**
+*@brief runs a thread and checks if it is still running.
+*	EX:- while(PT_IS_RUNNING(enuBlink(&stBlink)));
+*/
+#define PT_IS_RUNNING(_CALL)			((_CALL) < PT_enuExited)
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/*
+*@brief the returns of the function of a thread.
+*
+*/
+typedef enum
+{
+     /**
+     *@brief the thread waits a condition , a time or an event.
+     */
+     PT_enuWaiting ,
+
+     /**
+     *@brief the thread gave the CPU by PT_YIELD.
+     */
+     PT_enuYielded ,
+
+     /**
+     *@brief the thread ended by PT_EXIT.
+     */
+     PT_enuExited ,
+
+     /**
+     *@brief the thread reached PT_END.
+     */
+     PT_enuEnded
+
+} PT_enuStates_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief the state of a thread.
+*
+*/
+typedef struct
+{
+     /**
+     *@brief the line of the last wait , 0 before the first line.
+     */
+     uint16_t u16Line;
+
+     /**
+     *@brief the start of PT_WAIT_MS.
+     */
+     uint32_t u32Start;
+
+} PT_stThread_t;
+
+
+/*
+*@brief an event which an interrupt signals and a thread waits on it , the
+*	signals before the wait are one signal.
+*/
+typedef volatile uint8_t PT_Event_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				signals an event , it is called from the
+ *					interrupts or the threads.
+ *
+ * @param[in] ADD_pEvent		the event.
+ *					EX:- static void vRxDone(void * pvBuff, uint16_t u16Len) { PT_vSignal(&RxEvt); }
+*/
+/*----------------------------------------------------------------------------*/
+static inline void PT_vSignal(PT_Event_t * ADD_pEvent) __attribute__((always_inline));
+static inline void PT_vSignal(PT_Event_t * ADD_pEvent)
+{
+	*ADD_pEvent = 1;								/*one byte is written atomically*/
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief				takes the event if it is signaled.
+ *
+ * @param[in] ADD_pEvent		the event.
+ *
+ * @return TRUE if it was signaled , it is cleared.
+*/
+/*----------------------------------------------------------------------------*/
+static inline boolean PT_bTakeEvent(PT_Event_t * ADD_pEvent) __attribute__((always_inline));
+static inline boolean PT_bTakeEvent(PT_Event_t * ADD_pEvent)
+{
+	boolean RET_bSignaled = FALSE;
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*a signal between the read and the clear is not lost*/
+	if(*ADD_pEvent != 0)
+	{
+		*ADD_pEvent   = 0;
+		RET_bSignaled = TRUE;
+	}
+	CRITICAL_vExit(LOC_u8SREG);
+	return RET_bSignaled;
+}
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* PT_H_ */
+/******************************************************************************/
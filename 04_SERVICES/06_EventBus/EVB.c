@@ -0,0 +1,238 @@
+/******************************************************************************/
+/**
+ * @file EVB.c
+ * @brief static publish/subscribe event bus.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the posted events are a ring of entries with free running 8-bit head and
+ * tail , the producers (the interrupts and the main loop) move the head and
+ * the dispatcher moves the tail only , so the dispatcher reads the queue
+ * without disabling the interrupts. a post takes a short critical section
+ * because the main loop posts too. a coalesced event has a pending bit and its
+ * latest data , a post while the bit is set only replaces the data.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "EVB.h"
+#include "EVB_CFG.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the mask of the queue indexes.
+*/
+#define			QUEUE_MASK				(EVB_QUEUE_SIZE - 1)
+
+/******************************************************************************/
+
+#if EVB_NUMBER_OF_EVENTS < 1 || EVB_NUMBER_OF_EVENTS > 32
+#error EVB_NUMBER_OF_EVENTS must be from 1 to 32.
+#endif
+
+#if EVB_QUEUE_SIZE < 2 || EVB_QUEUE_SIZE > 128 || (EVB_QUEUE_SIZE & (EVB_QUEUE_SIZE - 1)) != 0
+#error EVB_QUEUE_SIZE must be a power of 2 from 2 to 128.
+#endif
+
+#if EVB_MAX_SUBSCRIBERS < 1
+#error EVB_MAX_SUBSCRIBERS must be 1 at least.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/**
+*@brief the bit of the event in the pending mask.
+*/
+#define			EVENT_BIT(_EVENT)			((uint32_t)1 << (_EVENT))
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/**
+*@brief one posted event.
+*/
+typedef struct
+{
+	uint8_t u8Event;
+	uint16_t u16Data;
+
+} stEntry_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the queue , the entries are from the tail to the head.
+*/
+static volatile stEntry_t astQueue[EVB_QUEUE_SIZE];
+static volatile uint8_t u8Head = 0;
+static volatile uint8_t u8Tail = 0;
+
+/**
+*@brief the coalesced events which are in the queue , a bit for each event ,
+*	and their latest data.
+*/
+static volatile uint32_t u32Pending = 0;
+static volatile uint16_t au16Latest[EVB_NUMBER_OF_EVENTS];
+
+static volatile uint16_t u16Dropped = 0;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+void EVB_vInit(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	u8Head     = 0;
+	u8Tail     = 0;
+	u32Pending = 0;
+	u16Dropped = 0;
+	CRITICAL_vExit(LOC_u8SREG);
+}
+
+
+EVB_enuErrors_t EVB_enuPost(uint8_t Copy_u8Event, uint16_t Copy_u16Data)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	EVB_enuErrors_t RET_enuErrorStatus = EVB_enuOK;
+
+	if(Copy_u8Event >= EVB_NUMBER_OF_EVENTS)
+	{
+		RET_enuErrorStatus = EVB_enuInvalidEvent;
+	}
+	else
+	{
+		uint8_t LOC_u8SREG = CRITICAL_u8Enter();				/*an interrupt may post in the middle of a post of the main loop*/
+		boolean LOC_bCoalesce = EVB_castEvents[Copy_u8Event].bCoalesce;
+		if(LOC_bCoalesce == TRUE && (u32Pending & EVENT_BIT(Copy_u8Event)))
+		{
+			/*the event is in the queue , its subscribers will get this data*/
+			au16Latest[Copy_u8Event] = Copy_u16Data;
+		}
+		else if((uint8_t)(u8Head - u8Tail) == EVB_QUEUE_SIZE)
+		{
+			if(u16Dropped != 0xFFFF)
+			{
+				u16Dropped++;
+			}
+			RET_enuErrorStatus = EVB_enuQueueFull;
+		}
+		else
+		{
+			if(LOC_bCoalesce == TRUE)
+			{
+				au16Latest[Copy_u8Event] = Copy_u16Data;
+				u32Pending |= EVENT_BIT(Copy_u8Event);
+			}
+			astQueue[u8Head & QUEUE_MASK].u8Event = Copy_u8Event;
+			astQueue[u8Head & QUEUE_MASK].u16Data = Copy_u16Data;
+			u8Head++;								/*the entry is written before it is counted*/
+		}
+		CRITICAL_vExit(LOC_u8SREG);
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+void EVB_vDispatch(void)
+{
+	while(u8Tail != u8Head)
+	{
+		stEntry_t LOC_stEntry;
+		LOC_stEntry.u8Event = astQueue[u8Tail & QUEUE_MASK].u8Event;
+		LOC_stEntry.u16Data = astQueue[u8Tail & QUEUE_MASK].u16Data;
+		u8Tail++;									/*the place is free after the copy*/
+
+		if(EVB_castEvents[LOC_stEntry.u8Event].bCoalesce == TRUE)
+		{
+			/*the next post of the event is queued again*/
+			uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+			LOC_stEntry.u16Data = au16Latest[LOC_stEntry.u8Event];
+			u32Pending &= ~EVENT_BIT(LOC_stEntry.u8Event);
+			CRITICAL_vExit(LOC_u8SREG);
+		}
+
+		for(uint8_t LOC_u8Sub = 0 ; LOC_u8Sub < EVB_MAX_SUBSCRIBERS ; LOC_u8Sub++)
+		{
+			if(EVB_castEvents[LOC_stEntry.u8Event].apfSubscribers[LOC_u8Sub] != NULL)
+			{
+				EVB_castEvents[LOC_stEntry.u8Event].apfSubscribers[LOC_u8Sub](LOC_stEntry.u8Event,LOC_stEntry.u16Data);
+			}
+		}
+	}
+}
+
+
+uint16_t EVB_u16GetDropped(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();					/*the interrupts count the drops*/
+	uint16_t LOC_u16Dropped = u16Dropped;
+	CRITICAL_vExit(LOC_u8SREG);
+	return LOC_u16Dropped;
+}
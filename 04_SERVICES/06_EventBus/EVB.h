@@ -0,0 +1,168 @@
+/******************************************************************************/
+/**
+ * @file EVB.h
+ * @brief event bus API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * event bus. the events are named in EVB_CFG.h and each one has a static list
+ * of subscribers in EVB_CFG.c. an interrupt or the main loop posts an event
+ * with 16-bit data to a fixed queue and returns , the main loop dispatches the
+ * queue and calls all the subscribers of each event. so the interrupts stay
+ * short and more than one module reacts to the same event without polling.
+ * an event of a high rate source can be coalesced , it is in the queue once
+ * and its subscribers get the latest data.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef EVB_H_
+#define EVB_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "EVB_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all event bus errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     EVB_enuOK ,
+
+     /**
+     *@brief if you entered an event out of EVB_NUMBER_OF_EVENTS.
+     */
+     EVB_enuInvalidEvent,
+
+     /**
+     *@brief if the queue is full , the event is dropped and counted.
+     */
+     EVB_enuQueueFull
+
+} EVB_enuErrors_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief clears the queue , the pending coalesced events and the dropped count.
+ *
+ * @note it is called before the interrupts which post are enabled.
+ */
+void EVB_vInit(void);
+
+/**
+ * @brief posts an event to the queue , it doesn't call the subscribers.
+ *
+ * @param[in] Copy_u8Event	the event from 0 to (EVB_NUMBER_OF_EVENTS - 1).
+ *
+ * @param[in] Copy_u16Data	the data passed to the subscribers.
+ *
+ * @return the event bus error status.
+ *
+ * @note it is called from the interrupts and the main loop.
+ *	EX:- static void vLeftPressed(void * ADD_pvParam) { EVB_enuPost(EVB_EVT_TURN_LEFT,0); }
+ */
+EVB_enuErrors_t EVB_enuPost(uint8_t Copy_u8Event, uint16_t Copy_u16Data);
+
+/**
+ * @brief calls the subscribers of the posted events by their order and returns
+ *	when the queue is empty.
+ *
+ * @note it is called from the main loop only , a subscriber may post.
+ *	EX:- while(1) { EVB_vDispatch(); }
+ */
+void EVB_vDispatch(void);
+
+/**
+ * @brief gets the number of the events dropped because the queue was full ,
+ *	it stops at 0xFFFF.
+ */
+uint16_t EVB_u16GetDropped(void);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* EVB_H_ */
+/******************************************************************************/
@@ -0,0 +1,115 @@
+/*******************************************************************************/
+/**
+ * @file EVB_CFG.c
+ * @brief  the table of the event bus events
+ *
+ * @par Project Name
+ *	AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * this file contains the events which you configured their names in EVB_CFG.h
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "EVB_CFG.h"
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/************************************************************************/
+/* you should put all events configurations here
+/************************************************************************/
+const EVB_stEvent_t EVB_castEvents[EVB_NUMBER_OF_EVENTS] =
+{
+	[EVB_EVT_TURN_LEFT] =
+	{
+		.bCoalesce      = FALSE ,				/*each press is a turn*/
+		.apfSubscribers = { APP_vTurnLeft , NULL }
+	},
+	[EVB_EVT_TURN_RIGHT] =
+	{
+		.bCoalesce      = FALSE ,
+		.apfSubscribers = { APP_vTurnRight , NULL }
+	},
+	[EVB_EVT_ADC_SAMPLE] =
+	{
+		.bCoalesce      = TRUE ,				/*only the latest sample matters*/
+		.apfSubscribers = { NULL , NULL }
+	}
+};
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*******************************************************************************/
+/**
+* @file EVB_CFG.h
+* @brief Header file for the event bus configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the event bus , the names of
+* the events and the functions of their subscribers. the table of the events
+* is in EVB_CFG.c.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef EVB_CFG_H_
+#define EVB_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   EVB Configurations		                      */
+/******************************************************************************/
+
+/**
+*@brief the number of the events in the table of EVB_CFG.c , from 1 to 32.
+*/
+#define			EVB_NUMBER_OF_EVENTS			3
+
+/**
+*@brief the names of the events , they are the indexes of the table.
+*/
+#define			EVB_EVT_TURN_LEFT			0
+#define			EVB_EVT_TURN_RIGHT			1
+#define			EVB_EVT_ADC_SAMPLE			2
+
+/**
+*@brief the maximum subscribers of one event.
+*/
+#define			EVB_MAX_SUBSCRIBERS			2
+
+/**
+*@brief the places of the queue of the posted events , a power of 2 from 2 to 128.
+*/
+#define			EVB_QUEUE_SIZE				8
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/**
+*@brief one event of the table.
+*/
+typedef struct
+{
+	boolean bCoalesce;				/*TRUE for the high rate sources , the posts while the event waits in the queue
+							  only update its data so the subscribers get the latest one once*/
+	void (*apfSubscribers[EVB_MAX_SUBSCRIBERS])(uint8_t Copy_u8Event, uint16_t Copy_u16Data);	/*NULL for the unused places*/
+
+} EVB_stEvent_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/**
+*@brief the table of the events.
+*/
+extern const EVB_stEvent_t EVB_castEvents[EVB_NUMBER_OF_EVENTS];
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+*@brief the functions of the subscribers , they are defined by the application.
+*/
+void APP_vTurnLeft(uint8_t Copy_u8Event, uint16_t Copy_u16Data);
+void APP_vTurnRight(uint8_t Copy_u8Event, uint16_t Copy_u16Data);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* EVB_CFG_H_ */
+/******************************************************************************/
@@ -0,0 +1,246 @@
+/******************************************************************************/
+/**
+ * @file PWR.c
+ * @brief sleep manager which selects the deepest safe sleep mode.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the mode is selected from the work of the drivers and the clocks of the
+ * timers and the ADC as they are in the registers , so a peripheral which is
+ * started by any driver is seen. the interrupts are disabled from the check of
+ * the work to the sleep , the instruction after sei is always executed so
+ * "sei ; sleep" can't miss an interrupt which came after the check , it wakes
+ * the CPU at once.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "PWR.h"
+#include "PWR_CFG.h"
+#include "../../01_MCAL/02_Interrupt/Critical.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+#include "../../01_MCAL/03_Timers/Timer.h"
+#endif
+#if PWR_USE_UART == PWR_ON
+#include "../../01_MCAL/07_UART/Uart.h"
+#endif
+#if PWR_USE_TWI == PWR_ON
+#include "../../01_MCAL/08_TWI/TWI.h"
+#endif
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the registers which show the clocks and the interrupts.
+*/
+#define			MCUCR					*((volatile uint8_t *)0x55)
+#define			GICR					*((volatile uint8_t *)0x5B)
+#define			TCCR0					*((volatile uint8_t *)0x53)
+#define			TCCR1B					*((volatile uint8_t *)0x4E)
+#define			TCCR2					*((volatile uint8_t *)0x45)
+#define			ASSR					*((volatile uint8_t *)0x42)
+#define			ADCSRA					*((volatile uint8_t *)0x26)
+
+#define			SE					7
+#define			SM_MASK					0x70
+#define			SM0					4
+#define			INT1					7
+#define			INT0					6
+#define			ISC1_MASK				0x0C
+#define			ISC0_MASK				0x03
+#define			AS2					3
+#define			CS_MASK					0x07
+#define			ADEN					7
+#define			ADSC					6
+#define			ADIE					3
+
+/******************************************************************************/
+
+#if PWR_DEEPEST_MODE < PWR_IDLE || PWR_DEEPEST_MODE > PWR_POWER_DOWN
+#error PWR_DEEPEST_MODE configure in wrong way.
+#endif
+
+#if (PWR_USE_UART != PWR_ON && PWR_USE_UART != PWR_OFF) || (PWR_USE_TWI != PWR_ON && PWR_USE_TWI != PWR_OFF)
+#error PWR_USE_UART and PWR_USE_TWI configure in wrong way.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the SM2..SM0 bits of each mode.
+*/
+static const uint8_t au8SleepBits[] =
+{
+	[PWR_enuIdle]              = (0 << SM0),
+	[PWR_enuAdcNoiseReduction] = (1 << SM0),
+	[PWR_enuPowerSave]         = (3 << SM0),
+	[PWR_enuPowerDown]         = (2 << SM0)
+};
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief checks if a driver needs the I/O clock or an enabled interrupt can
+*	wake the CPU from the Idle mode only.
+*/
+static boolean bNeedsIOClock(void);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static boolean bNeedsIOClock(void)
+{
+	boolean RET_bNeeds = FALSE;
+
+	#if PWR_USE_UART == PWR_ON
+	if(Uart_bIsBusy())
+	{
+		RET_bNeeds = TRUE;
+	}
+	#endif
+	#if PWR_USE_TWI == PWR_ON
+	if(TWI_Is_Busy() == TRUE)
+	{
+		RET_bNeeds = TRUE;
+	}
+	#endif
+
+	/*the synchronous timers count the I/O clock*/
+	if((TCCR0 & CS_MASK) != 0 || (TCCR1B & CS_MASK) != 0 ||
+	   ((TCCR2 & CS_MASK) != 0 && (ASSR & (1 << AS2)) == 0))
+	{
+		RET_bNeeds = TRUE;
+	}
+
+	/*an edge of INT0 or INT1 is sensed by the I/O clock , only a low level wakes the deep modes*/
+	if(((GICR & (1 << INT0)) && (MCUCR & ISC0_MASK) != 0) ||
+	   ((GICR & (1 << INT1)) && (MCUCR & ISC1_MASK) != 0))
+	{
+		RET_bNeeds = TRUE;
+	}
+
+	return RET_bNeeds;
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+PWR_enuModes_t PWR_enuGetSleepMode(void)
+{
+	PWR_enuModes_t RET_enuMode = PWR_enuPowerDown;
+
+	if(bNeedsIOClock() == TRUE)
+	{
+		RET_enuMode = PWR_enuIdle;
+	}
+	else if((ADCSRA & ((1 << ADEN) | (1 << ADSC) | (1 << ADIE))) == ((1 << ADEN) | (1 << ADSC) | (1 << ADIE)))
+	{
+		/*the conversion ends in the quiet mode and its interrupt wakes the CPU*/
+		RET_enuMode = PWR_enuAdcNoiseReduction;
+	}
+	else if((TCCR2 & CS_MASK) != 0 && (ASSR & (1 << AS2)))
+	{
+		RET_enuMode = PWR_enuPowerSave;
+	}
+	else
+	{
+		/*Do nothing*/
+	}
+
+	if(RET_enuMode > PWR_DEEPEST_MODE)
+	{
+		RET_enuMode = (PWR_enuModes_t)PWR_DEEPEST_MODE;
+	}
+	return RET_enuMode;
+}
+
+
+void PWR_vIdle(void)
+{
+	uint8_t LOC_u8SREG = CRITICAL_u8Enter();
+	if(PWR_WORK_PENDING() == FALSE)
+	{
+		PWR_enuModes_t LOC_enuMode = PWR_enuGetSleepMode();
+
+		#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+		if(LOC_enuMode == PWR_enuPowerSave)
+		{
+			Timer_vSyncRTC();
+		}
+		#endif
+
+		/*MCUCR has the sense bits of INT0 and INT1 too*/
+		MCUCR = (MCUCR & (uint8_t)~SM_MASK) | au8SleepBits[LOC_enuMode] | (1 << SE);
+		__asm__ __volatile__ ("sei"   "\n\t"
+				      "sleep" "\n\t"
+				      "cli"
+				      :
+				      :
+				      : "memory");
+		MCUCR &= (uint8_t)~(1 << SE);
+	}
+	CRITICAL_vExit(LOC_u8SREG);
+}
@@ -0,0 +1,140 @@
+/******************************************************************************/
+/**
+ * @file PWR.h
+ * @brief sleep manager API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * sleep manager. the main loop calls it when it has no work , it selects the
+ * deepest sleep mode which doesn't stop a clock that a driver needs now and
+ * which still wakes on the enabled interrupts , then it sleeps until an
+ * interrupt comes:
+ *  - Idle if the UART or the TWI has a transfer , Timer0 or Timer1 (or Timer2
+ *    from the CPU clock) is counting , or INT0/INT1 is sensed on an edge.
+ *  - ADC Noise Reduction if an ADC conversion with its interrupt is running.
+ *  - Power-save if Timer2 runs asynchronously from the watch crystal.
+ *  - Power-down otherwise , it wakes on INT2 , a low level of INT0/INT1 or
+ *    the TWI address match.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef PWR_H_
+#define PWR_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "PWR_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief the sleep modes from the lightest to the deepest.
+*
+*/
+typedef enum
+{
+     PWR_enuIdle = PWR_IDLE ,
+     PWR_enuAdcNoiseReduction = PWR_ADC_NOISE_REDUCTION ,
+     PWR_enuPowerSave = PWR_POWER_SAVE ,
+     PWR_enuPowerDown = PWR_POWER_DOWN
+
+} PWR_enuModes_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief selects the sleep mode and sleeps until an interrupt wakes the CPU ,
+ *	it returns after the interrupt is served.
+ *
+ * @note it enables the global interrupt to sleep , it returns at once if
+ *	PWR_WORK_PENDING() is TRUE.
+ *	EX:- while(1) { EVB_vDispatch(); PWR_vIdle(); }
+ */
+void PWR_vIdle(void);
+
+/**
+ * @brief gets the mode which PWR_vIdle selects now.
+ */
+PWR_enuModes_t PWR_enuGetSleepMode(void);
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* PWR_H_ */
+/******************************************************************************/
@@ -0,0 +1,129 @@
+/*******************************************************************************/
+/**
+* @file PWR_CFG.h
+* @brief Header file for the sleep manager configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the sleep manager , the
+* drivers which it asks about their work and the deepest allowed mode.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef PWR_CFG_H_
+#define PWR_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   PWR Configurations		                      */
+/******************************************************************************/
+
+#define			PWR_ON					1
+#define			PWR_OFF					0
+
+/**
+*@brief the sleep modes from the lightest to the deepest.
+*/
+#define			PWR_IDLE				0
+#define			PWR_ADC_NOISE_REDUCTION			1
+#define			PWR_POWER_SAVE				2
+#define			PWR_POWER_DOWN				3
+
+/**
+*@brief the deepest mode which the manager may select , PWR_IDLE keeps the
+*	debugger and all the clocks alive.
+*/
+#define			PWR_DEEPEST_MODE			PWR_POWER_DOWN
+
+/**
+*@brief PWR_ON if the driver is linked , the manager asks it about its work.
+*/
+#define			PWR_USE_UART				PWR_ON
+#define			PWR_USE_TWI				PWR_ON
+
+/**
+*@brief checked with the interrupts disabled just before the sleep , TRUE
+*	cancels the sleep so a work posted by an interrupt after the last check
+*	of the main loop is not delayed to the next wake up.
+*	EX:- #define PWR_WORK_PENDING()	(APP_u8Flags != 0)
+*/
+#define			PWR_WORK_PENDING()			(FALSE)
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* PWR_CFG_H_ */
+/******************************************************************************/
@@ -0,0 +1,303 @@
+/******************************************************************************/
+/**
+ * @file LOAD.c
+ * @brief CPU load and idle time monitor.
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * the idle time is the sum of the times from LOAD_vIdleEnter to
+ * LOAD_vIdleExit by STIME_u32Micros , a window is closed only by the hooks so
+ * an idle time is never split between two windows and the window is measured
+ * by its real length. with LOAD_ISR_SHARE the time of the interrupts is read
+ * from the ISR trace at the hooks , the interrupts in the idle time (the one
+ * which wakes the CPU for example) are moved from the idle time to the load.
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "LOAD.h"
+#include "LOAD_CFG.h"
+#include "../02_SysTime/STIME.h"
+#if LOAD_ISR_SHARE == LOAD_ON
+#include "../../01_MCAL/02_Interrupt/ISR.h"
+#include "../../01_MCAL/03_Timers/Timers_CFG.h"
+#endif
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the length of the window in micro-seconds.
+*/
+#define			WINDOW_US				((uint32_t)LOAD_WINDOW_MS * 1000UL)
+
+/**
+*@brief the highest time which is multiplied by LOAD_FULL in 32 bits.
+*/
+#define			MAX_SCALED_US				(0xFFFFFFFFUL / LOAD_FULL)
+
+/******************************************************************************/
+
+#if LOAD_WINDOW_MS < 10 || LOAD_WINDOW_MS > 10000
+#error LOAD_WINDOW_MS must be from 10 to 10000.
+#endif
+
+#if LOAD_ISR_SHARE != LOAD_ON && LOAD_ISR_SHARE != LOAD_OFF
+#error LOAD_ISR_SHARE configure in wrong way.
+#endif
+
+#if LOAD_ISR_SHARE == LOAD_ON && ISR_TRACE != ISR_ON
+#error LOAD_ISR_SHARE needs ISR_TRACE to be ISR_ON.
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE MACROS */
+/******************************************************************************/
+
+#if LOAD_ISR_SHARE == LOAD_ON
+/**
+*@brief the prescaler of the trace timebase.
+*/
+#if ISR_TRACE_PRESCALER == ISR_TRACE_CLK_1
+#define			TRACE_PRESCALER				1ULL
+#elif ISR_TRACE_PRESCALER == ISR_TRACE_CLK_8
+#define			TRACE_PRESCALER				8ULL
+#else
+#define			TRACE_PRESCALER				64ULL
+#endif
+
+/**
+*@brief converts trace ticks to micro-seconds.
+*/
+#define			TRACE_TICKS_TO_US(_TICKS)		((uint32_t)(((_TICKS) * TRACE_PRESCALER * 1000000ULL) / F_CPU))
+#endif
+
+/******************************************************************************/
+/* PRIVATE ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/**
+*@brief the open window , its start and its idle time.
+*/
+static uint32_t u32WindowStart = 0;
+static uint32_t u32IdleUs = 0;
+
+/**
+*@brief the start of the idle time , it is valid while bIdle is TRUE.
+*/
+static uint32_t u32IdleStart = 0;
+static boolean bIdle = FALSE;
+
+#if LOAD_ISR_SHARE == LOAD_ON
+/**
+*@brief the trace ticks at the start of the window and of the idle time , and
+*	the ticks of the interrupts in the idle time of the window.
+*/
+static uint32_t u32WindowTicks = 0;
+static uint32_t u32IdleStartTicks = 0;
+static uint32_t u32IdleIsrTicks = 0;
+#endif
+
+/**
+*@brief the measurements of the last closed window.
+*/
+static LOAD_stStats_t stStats;
+static boolean bHasWindow = FALSE;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DEFINITIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/**
+* @brief gets the part of the window from 0 to LOAD_FULL.
+*/
+static uint16_t u16Share(uint32_t Copy_u32PartUs, uint32_t Copy_u32WindowUs);
+
+/**
+* @brief closes the window if its time passed and opens the next one.
+*/
+static void vCheckWindow(uint32_t Copy_u32Now);
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PRIVATE FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+static uint16_t u16Share(uint32_t Copy_u32PartUs, uint32_t Copy_u32WindowUs)
+{
+	if(Copy_u32PartUs > Copy_u32WindowUs)
+	{
+		Copy_u32PartUs = Copy_u32WindowUs;
+	}
+	/*the part is not above the window after the shifts , so the share is not above LOAD_FULL*/
+	while(Copy_u32PartUs > MAX_SCALED_US)
+	{
+		Copy_u32PartUs   >>= 1;
+		Copy_u32WindowUs >>= 1;
+	}
+	return (uint16_t)((Copy_u32PartUs * (uint32_t)LOAD_FULL) / Copy_u32WindowUs);
+}
+
+
+static void vCheckWindow(uint32_t Copy_u32Now)
+{
+	uint32_t LOC_u32WindowUs = Copy_u32Now - u32WindowStart;
+	if(LOC_u32WindowUs >= WINDOW_US)
+	{
+		uint32_t LOC_u32IdleUs = u32IdleUs;
+		uint32_t LOC_u32BusyUs;
+
+		#if LOAD_ISR_SHARE == LOAD_ON
+		uint32_t LOC_u32Ticks = ISR_u32TraceGetTotalTicks();
+		uint32_t LOC_u32IdleIsrUs = TRACE_TICKS_TO_US(u32IdleIsrTicks);
+		stStats.u16IsrShare = u16Share(TRACE_TICKS_TO_US(LOC_u32Ticks - u32WindowTicks),LOC_u32WindowUs);
+		/*the interrupts in the idle time are load*/
+		LOC_u32IdleUs = (LOC_u32IdleIsrUs < LOC_u32IdleUs) ? (LOC_u32IdleUs - LOC_u32IdleIsrUs) : 0;
+		u32WindowTicks  = LOC_u32Ticks;
+		u32IdleIsrTicks = 0;
+		#else
+		stStats.u16IsrShare = 0;
+		#endif
+
+		if(LOC_u32IdleUs > LOC_u32WindowUs)
+		{
+			LOC_u32IdleUs = LOC_u32WindowUs;
+		}
+		LOC_u32BusyUs = LOC_u32WindowUs - LOC_u32IdleUs;
+
+		stStats.u16Load     = u16Share(LOC_u32BusyUs,LOC_u32WindowUs);
+		stStats.u32IdleUs   = LOC_u32IdleUs;
+		stStats.u32WindowUs = LOC_u32WindowUs;
+		if(stStats.u16Load > stStats.u16Peak)
+		{
+			stStats.u16Peak = stStats.u16Load;
+		}
+		bHasWindow = TRUE;
+
+		u32WindowStart = Copy_u32Now;
+		u32IdleUs      = 0;
+	}
+}
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION DEFINITIONS */
+/******************************************************************************/
+
+void LOAD_vInit(void)
+{
+	u32WindowStart  = STIME_u32Micros();
+	u32IdleUs       = 0;
+	bIdle           = FALSE;
+	stStats.u16Peak = 0;
+	bHasWindow      = FALSE;
+	#if LOAD_ISR_SHARE == LOAD_ON
+	u32WindowTicks  = ISR_u32TraceGetTotalTicks();
+	u32IdleIsrTicks = 0;
+	#endif
+}
+
+
+void LOAD_vIdleEnter(void)
+{
+	uint32_t LOC_u32Now = STIME_u32Micros();
+	vCheckWindow(LOC_u32Now);
+	u32IdleStart = LOC_u32Now;
+	bIdle        = TRUE;
+	#if LOAD_ISR_SHARE == LOAD_ON
+	u32IdleStartTicks = ISR_u32TraceGetTotalTicks();
+	#endif
+}
+
+
+void LOAD_vIdleExit(void)
+{
+	if(bIdle == TRUE)
+	{
+		uint32_t LOC_u32Now = STIME_u32Micros();
+		u32IdleUs += LOC_u32Now - u32IdleStart;
+		bIdle      = FALSE;
+		#if LOAD_ISR_SHARE == LOAD_ON
+		u32IdleIsrTicks += ISR_u32TraceGetTotalTicks() - u32IdleStartTicks;
+		#endif
+		vCheckWindow(LOC_u32Now);
+	}
+}
+
+
+LOAD_enuErrors_t LOAD_enuGetStats(LOAD_stStats_t * ADD_pstStats)
+{
+	/*it is the return of the function it contain the error status of the function.*/
+	LOAD_enuErrors_t RET_enuErrorStatus = LOAD_enuOK;
+
+	if(ADD_pstStats == NULL)
+	{
+		RET_enuErrorStatus = LOAD_enuNullPtr;
+	}
+	else if(bHasWindow == FALSE)
+	{
+		RET_enuErrorStatus = LOAD_enuNoWindow;
+	}
+	else
+	{
+		*ADD_pstStats = stStats;
+	}
+
+	/*to return the error status*/
+	return RET_enuErrorStatus;
+}
+
+
+void LOAD_vResetPeak(void)
+{
+	stStats.u16Peak = 0;
+}
@@ -0,0 +1,214 @@
+/******************************************************************************/
+/**
+ * @file LOAD.h
+ * @brief CPU load monitor API header for ATmega32 micro-controller
+ *
+ * @par Project Name
+ * AVR drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * This header file provides function prototypes and definitions for the
+ * CPU load monitor. the main loop calls the idle hooks around its idle work
+ * (the sleep for example) , the time between them is read from the system
+ * time service and the rest of each window is the load. each window gives
+ * the load , the idle time and the share of the interrupts , and the highest
+ * load is kept as the peak.
+ * the system time service must be running (STIME_vInit) , the load of a main
+ * loop which never reaches the idle hook is seen at its next idle.
+ *
+ * @par EX:-
+ *	while(1)
+ *	{
+ *		EVB_vDispatch();
+ *		LOAD_vIdleEnter();
+ *		PWR_vIdle();
+ *		LOAD_vIdleExit();
+ *	}
+ *
+ * @par Author
+ * Mahmoud Abou-Hawis
+ *
+ ******************************************************************************/
+
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef LOAD_H_
+#define LOAD_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../../00_LIB/Platform_Types.h"
+#include "LOAD_CFG.h"
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/**
+*@brief the load of a full CPU , the loads are in hundredths of a percent.
+*/
+#define LOAD_FULL			10000
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/*
+*@brief these are all load monitor errors which may occur when using APIs in wrong way.
+*
+*/
+typedef enum
+{
+    /**
+    *@brief returned if the function did it functionality correctly.
+    */
+     LOAD_enuOK ,
+
+     /**
+     *@brief if the first window is not closed yet.
+     */
+     LOAD_enuNoWindow,
+
+    /**
+    *@brief returned if you pass a null pointer to functions.
+    */
+     LOAD_enuNullPtr
+
+} LOAD_enuErrors_t;
+
+
+/*
+*@brief the measurements of the last closed window.
+*
+*/
+typedef struct
+{
+     /**
+     *@brief the time out of the idle hooks from 0 to LOAD_FULL.
+     */
+     uint16_t u16Load;
+
+     /**
+     *@brief the highest load from LOAD_vInit or LOAD_vResetPeak.
+     */
+     uint16_t u16Peak;
+
+     /**
+     *@brief the time of the interrupts from 0 to LOAD_FULL , 0 if
+     *	LOAD_ISR_SHARE is LOAD_OFF.
+     */
+     uint16_t u16IsrShare;
+
+     /**
+     *@brief the idle time of the window in micro-seconds.
+     */
+     uint32_t u32IdleUs;
+
+     /**
+     *@brief the length of the window in micro-seconds , LOAD_WINDOW_MS at
+     *	least.
+     */
+     uint32_t u32WindowUs;
+
+} LOAD_stStats_t;
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+
+/**
+ * @brief starts the first window and clears the peak , it is called after
+ *	STIME_vInit.
+ */
+void LOAD_vInit(void);
+
+/**
+ * @brief the CPU becomes idle , it closes the window if its time passed.
+ *
+ * @note it is called from the main loop only.
+ */
+void LOAD_vIdleEnter(void);
+
+/**
+ * @brief the CPU has work again , the time from LOAD_vIdleEnter is idle.
+ *
+ * @note it is called from the main loop only.
+ */
+void LOAD_vIdleExit(void);
+
+/**
+ * @brief gets the measurements of the last closed window.
+ *
+ * @param[out] ADD_pstStats	the measurements.
+ *
+ * @return LOAD_enuNoWindow before the first window is closed.
+ */
+LOAD_enuErrors_t LOAD_enuGetStats(LOAD_stStats_t * ADD_pstStats);
+
+/**
+ * @brief the peak starts from the next window.
+ */
+void LOAD_vResetPeak(void);
+
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* LOAD_H_ */
+/******************************************************************************/
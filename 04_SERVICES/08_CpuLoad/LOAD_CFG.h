@@ -0,0 +1,114 @@
+/*******************************************************************************/
+/**
+* @file LOAD_CFG.h
+* @brief Header file for the CPU load monitor configuration.
+*
+* @par Project Name
+* AVR atmega32 drivers.
+*
+* @par Code Language
+* C
+*
+* @par Description
+* This header file contains configurations for the CPU load monitor , the
+* length of the measuring window and the share of the interrupts.
+*
+* @par Author
+* Mahmoud Abou-Hawis
+*******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef LOAD_CFG_H_
+#define LOAD_CFG_H_
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+/******************************************************************************/
+/*			   LOAD Configurations		                      */
+/******************************************************************************/
+
+#define			LOAD_ON					1
+#define			LOAD_OFF				0
+
+/**
+*@brief the length of the window of the load in milli-seconds from 10 to 10000 ,
+*	a window is closed at the first idle hook after it.
+*/
+#define			LOAD_WINDOW_MS				1000
+
+/**
+*@brief LOAD_ON measures the time of the interrupts by the ISR trace , it needs
+*	ISR_TRACE to be ISR_ON. the interrupts which are served while the CPU
+*	is idle are counted as load too.
+*/
+#define			LOAD_ISR_SHARE				LOAD_OFF
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC ENUMS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC TYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC CONSTANT DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC VARIABLE DECLARATIONS */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC FUNCTION PROTOTYPES */
+/******************************************************************************/
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* LOAD_CFG_H_ */
+/******************************************************************************/
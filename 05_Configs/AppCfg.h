@@ -47,6 +47,7 @@ extern "C"
 #define CFG_APP_MAIN                 0
 #define CFG_APP_INT	       	     1
 #define CFG_APP_TMR0		     2
+#define CFG_APP_LCD		     3
 
 #define CURRENT_APP                  CFG_APP_TMR0  
 
@@ -0,0 +1,159 @@
+/******************************************************************************/
+/**
+ * @file PinsCfg.h
+ * @brief the pins which the HAL modules of the project use
+ *
+ * @par Project Name
+ *	Avr drivers
+ *
+ * @par Code Language
+ * C
+ *
+ * @par Description
+ * selects the HAL modules which are linked in the project and gives the pins
+ * of their configuration tables as a mask for each port , the PORT driver
+ * checks them at compile time so :
+ *	1- a pin used by two modules (or by the Timer2 watch crystal) is an error.
+ *	2- in PRE_COMPILATION_MODE a pin used by an output module must be output
+ *	   and a pin used by an input module must be input.
+ * the pins are read from the xxx_CFG.h of each used module , so the PORT
+ * driver doesn't include the HAL layer.
+ *
+ * @par Author
+ *Mahmoud Abou-Hawis
+ *
+ */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#ifndef PINS_CFG_H
+#define PINS_CFG_H
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC DEFINES */
+/******************************************************************************/
+
+#define CFG_ON                       1
+#define CFG_OFF                      0
+
+/**
+*@brief keep CFG_OFF for the modules which you don't use , their sample
+*	tables share the pins of the other modules.
+*/
+/*output modules*/
+#define CFG_USE_LED                  CFG_ON
+#define CFG_USE_SEG7                 CFG_OFF
+#define CFG_USE_LCD                  CFG_ON
+#define CFG_USE_SWPWM                CFG_ON
+
+/*input modules*/
+#define CFG_USE_SWITCH               CFG_ON
+
+/*input and output module*/
+#define CFG_USE_KEYPAD               CFG_OFF
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* INCLUDES */
+/******************************************************************************/
+#include "../01_MCAL/01_PORT/PORT.h"
+#include "../01_MCAL/03_Timers/Timers_CFG.h"
+#if CFG_USE_LED == CFG_ON
+#include "../02_HAL/00_LED/LED_CFG.h"
+#endif
+#if CFG_USE_SWITCH == CFG_ON
+#include "../02_HAL/01_Switch/SWITCH_CFG.h"
+#endif
+#if CFG_USE_SEG7 == CFG_ON
+#include "../02_HAL/02_7SEG/SEG7_CFG.h"
+#endif
+#if CFG_USE_LCD == CFG_ON
+#include "../02_HAL/03_LCD/LCD_CFG.h"
+#endif
+#if CFG_USE_KEYPAD == CFG_ON
+#include "../02_HAL/04_Keypad/Keypad_CFG.h"
+#endif
+#if CFG_USE_SWPWM == CFG_ON
+#include "../02_HAL/05_SWPWM/SWPWM_CFG.h"
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* PUBLIC MACROS */
+/******************************************************************************/
+
+/**
+*@brief the pins of each module in the port _P (PORT_NUM_PORTA .. PORT_NUM_PORTD) ,
+*	0 for the modules which are not used.
+*/
+#if CFG_USE_LED == CFG_ON
+#define CFG_LED_PINS(_P)             (LED_PINS(_P))
+#else
+#define CFG_LED_PINS(_P)             0
+#endif
+#if CFG_USE_SEG7 == CFG_ON
+#define CFG_SEG7_PINS(_P)            (SEG7_PINS(_P))
+#else
+#define CFG_SEG7_PINS(_P)            0
+#endif
+#if CFG_USE_LCD == CFG_ON
+#define CFG_LCD_PINS(_P)             (LCD_PINS(_P))
+#else
+#define CFG_LCD_PINS(_P)             0
+#endif
+#if CFG_USE_SWPWM == CFG_ON
+#define CFG_SWPWM_PINS(_P)           (SWPWM_PINS(_P))
+#else
+#define CFG_SWPWM_PINS(_P)           0
+#endif
+#if CFG_USE_SWITCH == CFG_ON
+#define CFG_SWITCH_PINS(_P)          (SWITCH_PINS(_P))
+#else
+#define CFG_SWITCH_PINS(_P)          0
+#endif
+#if CFG_USE_KEYPAD == CFG_ON
+#define CFG_KEYPAD_ROWS_PINS(_P)     (KEYPAD_ROWS_PINS(_P))
+#define CFG_KEYPAD_COLS_PINS(_P)     (KEYPAD_COLS_PINS(_P))
+#else
+#define CFG_KEYPAD_ROWS_PINS(_P)     0
+#define CFG_KEYPAD_COLS_PINS(_P)     0
+#endif
+
+/**
+*@brief TOSC1 and TOSC2 (PC6 and PC7) have the watch crystal of the Timer2 RTC.
+*/
+#if TIMER2_ENABLE == ON && TIMER2_RTC_ENABLE == ON
+#define CFG_RTC_PINS(_P)             (((_P) == PORT_NUM_PORTC) ? 0xC0 : 0)
+#else
+#define CFG_RTC_PINS(_P)             0
+#endif
+
+/******************************************************************************/
+
+/******************************************************************************/
+/* C++ Style GUARD */
+/******************************************************************************/
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+/******************************************************************************/
+
+/******************************************************************************/
+/* MULTIPLE INCLUSION GUARD */
+/******************************************************************************/
+#endif /* PINS_CFG_H */
+/******************************************************************************/
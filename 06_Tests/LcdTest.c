@@ -0,0 +1,54 @@
+/*
+ * LcdTest.c
+ *
+ * writes across the row 1 -> row 2 boundary of a 40x4 panel , the two rows
+ * belong to two controllers so the DDRAM address must go to the second one.
+ *
+ * expected on the panel :
+ *	row 0 : "A" at column 0
+ *	row 1 : "01234" at columns 35..39
+ *	row 2 : "56789" at columns 0..4
+ *	row 3 : "B" at column 39
+ * the LED is on when all the calls returned LCD_enuOK.
+ */
+
+#include "../05_Configs/AppCfg.h"
+
+
+
+#if CFG_IS_CURRENT_APP(CFG_APP_LCD)
+
+#include "../01_MCAL/01_PORT/PORT.h"
+#include "../02_HAL/00_LED/LED.h"
+#include "../02_HAL/03_LCD/LCD.h"
+#include "../02_HAL/03_LCD/LCD_CFG.h"
+
+#if NUM_OF_ROWS != 4 || NUM_OF_COLS != 40 || LCD_CONTROLLERS != 2
+#error the LCD test needs a 40x4 panel , set NUM_OF_ROWS 4 , NUM_OF_COLS 40 and LCD_CONTROLLERS 2.
+#endif
+
+void main()
+{
+	uint8_t LOC_u8Failed = 0;
+	char LOC_achText[] = "0123456789";
+
+	PORT_vInit();
+	LED_enmInit();
+	LCD_init();
+
+	/*five characters in row 1 (first controller) then the wrap to row 2 (second controller)*/
+	LOC_u8Failed |= (LCD_enuGotoDDRAM_XY(1,35) != LCD_enuOK);
+	LOC_u8Failed |= (LCD_enuWriteString(LOC_achText,10) != LCD_enuOK);
+
+	/*back from the second controller to the first one*/
+	LOC_u8Failed |= (LCD_enuGotoDDRAM_XY(0,0) != LCD_enuOK);
+	LOC_u8Failed |= (LCD_enuWriteData('A') != LCD_enuOK);
+
+	/*and to the second one again*/
+	LOC_u8Failed |= (LCD_enuGotoDDRAM_XY(3,39) != LCD_enuOK);
+	LOC_u8Failed |= (LCD_enuWriteData('B') != LCD_enuOK);
+
+	LED_enmSetLedState(FIRST_LED,(LOC_u8Failed == 0) ? LED_enmOn : LED_enmOff);
+	while(1);
+}
+#endif